@@ -19,14 +19,13 @@
 
 #include <eos/form-factors/form-factors.hh>
 #include <eos/b-decays/b-to-pi-pi-l-nu.hh>
-#include <eos/utils/integrate.hh>
+#include <eos/utils/integrate-impl.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/model.hh>
 #include <eos/utils/power_of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
-#include <gsl/gsl_monte.h>
-#include <gsl/gsl_monte_miser.h>
+#include <tuple>
 
 namespace eos
 {
@@ -49,10 +48,8 @@ namespace eos
 
         UsedParameter hbar;
 
-        // GSL elements for MC integration
-        gsl_rng * rng;
-        gsl_monte_function normalized_decay_width_integrand;
-        gsl_monte_miser_state * state;
+        // deterministic cubature, with at most as many integrand calls as for the previous MC integration
+        const cubature::Config cubature_config;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make(o.get("model", "SM"), p, o)),
@@ -62,8 +59,7 @@ namespace eos
             m_l(p["mass::" + o.get("l", "mu")], u),
             g_fermi(p["G_Fermi"], u),
             hbar(p["hbar"], u),
-            rng(gsl_rng_alloc(gsl_rng_mt19937)),
-            state(gsl_monte_miser_alloc(3u))
+            cubature_config(cubature::Config().epsrel(1e-4).maxeval(50000))
         {
             if (o.get("l", "mu") == "tau")
             {
@@ -85,12 +81,6 @@ namespace eos
             u.uses(*model);
         }
 
-        ~Implementation()
-        {
-            gsl_monte_miser_free(state);
-            gsl_rng_free(rng);
-        }
-
         // normalized to V_ub = 1
         double normalized_differential_decay_width(const double & q2, const double & k2, const double & z) const
         {
@@ -127,38 +117,62 @@ namespace eos
             return normalized_differential_decay_width(q2, k2, z) * std::norm(model->ckm_ub());
         }
 
-        static double normalized_differential_decay_width_gsl_adapter(double * parameters, size_t dim, void * _imp)
+        // the upper limit of k2 within the physical phase space at fixed q2
+        double k2_upper(const double & q2, const double & k2max) const
         {
-            if (dim != 3u)
-                throw InternalError("Implemenation<BToPiPiLeptonNeutrino::normalized_differentia_decay_width_gsl_adapter(): wrong number of parameters!");
+            return std::min(k2max, power_of<2>(m_B() - std::sqrt(q2)));
+        }
 
-            const double q2 = parameters[0];
-            const double k2 = parameters[1];
-            const double z  = parameters[2];
+        // the limits in q2 of the physical phase space within the given bounds, including the point
+        // at which the upper limit of k2 switches from k2max to the kinematic endpoint
+        std::vector<double> q2_boundaries(const double & q2min, const double & q2max,
+                const double & k2min, const double & k2max) const
+        {
+            const double q2_lower = std::max(q2min, power_of<2>(m_l()));
+            const double q2_upper = std::min(q2max, power_of<2>(m_B() - std::sqrt(k2min)));
 
-            auto imp = reinterpret_cast<const Implementation<BToPiPiLeptonNeutrino> *>(_imp);
+            if ((q2_lower >= q2_upper) || (k2min >= k2max))
+                return std::vector<double>{ };
 
-            if ((lambda(q2, k2, imp->m_B() * imp->m_B()) <= 0) || (q2 <= power_of<2>(imp->m_l())))
-                return 0.0;
+            const double q2_switch = power_of<2>(m_B() - std::sqrt(k2max));
+            if ((q2_lower < q2_switch) && (q2_switch < q2_upper))
+                return std::vector<double>{ q2_lower, q2_switch, q2_upper };
 
-            return imp->normalized_differential_decay_width(q2, k2, z);
+            return std::vector<double>{ q2_lower, q2_upper };
+        }
+
+        // maps t from [0, 1] onto the physical range of k2 at fixed q2, returning k2 and the Jacobian;
+        // the quadratic map removes the square-root behaviour of the phase space at the kinematic endpoint
+        std::pair<double, double> map_k2(const double & q2, const double & t, const double & k2min, const double & k2max) const
+        {
+            const double k2_max   = k2_upper(q2, k2max);
+            const double k2_range = k2_max - k2min;
+
+            return std::make_pair(k2_max - k2_range * power_of<2>(1.0 - t), 2.0 * k2_range * (1.0 - t));
         }
 
         double normalized_integrated_decay_width(const double & q2min, const double & q2max,
                 const double k2min, const double & k2max,
                 const double & zmin, const double & zmax) const
         {
-            // Yields a numerical error of approximately 0.2%.
-            static const size_t calls = 50000;
-
-            const double x_min[3] = { q2min, k2min, zmin };
-            const double x_max[3] = { q2max, k2max, zmax };
+            const cubature::fdd<3> integrand = [this, k2min, k2max] (const std::array<double, 3> & x)
+            {
+                double k2, jacobian;
+                std::tie(k2, jacobian) = map_k2(x[0], x[1], k2min, k2max);
 
-            gsl_monte_function integrand{ &normalized_differential_decay_width_gsl_adapter, 3u, const_cast<void *>(reinterpret_cast<const void *>(this)) };
+                return jacobian * normalized_differential_decay_width(x[0], k2, x[2]);
+            };
 
-            double result, error;
+            // integrate separately on each side of a kink in the q2 dependence
+            const std::vector<double> q2 = q2_boundaries(q2min, q2max, k2min, k2max);
+            double result = 0.0;
+            for (unsigned i = 1 ; i < q2.size() ; ++i)
+            {
+                const std::array<double, 3> x_min{{ q2[i - 1], 0.0, zmin }};
+                const std::array<double, 3> x_max{{ q2[i],     1.0, zmax }};
 
-            gsl_monte_miser_integrate(&integrand, x_min, x_max, 3u, calls, rng, state, &result, &error);
+                result += integrate(integrand, x_min, x_max, cubature_config);
+            }
 
             return result;
         }
@@ -166,23 +180,32 @@ namespace eos
         double normalized_integrated_forward_backward_asymmetry(const double & q2min, const double & q2max,
                 const double k2min, const double & k2max) const
         {
-            // Yields a numerical error of approximately 0.2%.
-            static const size_t calls = 50000;
+            // fold the backward region onto the forward region, such that both share the same subdivision
+            const std::function<std::array<double, 2> (const std::array<double, 3> &)> integrand = [this, k2min, k2max] (const std::array<double, 3> & x) -> std::array<double, 2>
+            {
+                double k2, jacobian;
+                std::tie(k2, jacobian) = map_k2(x[0], x[1], k2min, k2max);
 
-            const double x_forward_min[3]  = { q2min, k2min,  0.0 };
-            const double x_forward_max[3]  = { q2max, k2max, +1.0 };
-            const double x_backward_min[3] = { q2min, k2min, -1.0 };
-            const double x_backward_max[3] = { q2max, k2max,  0.0 };
+                const double forward  = jacobian * normalized_differential_decay_width(x[0], k2, +x[2]);
+                const double backward = jacobian * normalized_differential_decay_width(x[0], k2, -x[2]);
 
-            gsl_monte_function integrand{ &normalized_differential_decay_width_gsl_adapter, 3u, const_cast<void *>(reinterpret_cast<const void *>(this)) };
+                return {{ forward - backward, forward + backward }};
+            };
 
-            double forward,  forward_error;
-            double backward, backward_error;
+            // integrate separately on each side of a kink in the q2 dependence
+            const std::vector<double> q2 = q2_boundaries(q2min, q2max, k2min, k2max);
+            std::array<double, 2> integrals{{ 0.0, 0.0 }};
+            for (unsigned i = 1 ; i < q2.size() ; ++i)
+            {
+                const std::array<double, 3> x_min{{ q2[i - 1], 0.0, 0.0 }};
+                const std::array<double, 3> x_max{{ q2[i],     1.0, 1.0 }};
 
-            gsl_monte_miser_integrate(&integrand, x_forward_min, x_forward_max, 3u, calls, rng, state, &forward, &forward_error);
-            gsl_monte_miser_integrate(&integrand, x_backward_min, x_backward_max, 3u, calls, rng, state, &backward, &backward_error);
+                const std::array<double, 2> partial = integrate(integrand, x_min, x_max, cubature_config);
+                integrals[0] += partial[0];
+                integrals[1] += partial[1];
+            }
 
-            return (forward - backward) / (forward + backward);
+            return integrals[0] / integrals[1];
         }
     };
 
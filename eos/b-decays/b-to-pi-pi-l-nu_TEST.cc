@@ -60,12 +60,12 @@ class BToPiPiLeptonNeutrinoTest :
 
                 BToPiPiLeptonNeutrino d(p, oo);
 
-                const double eps = 2e-3;
+                const double eps = 1e-4;
 
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_branching_ratio(0.02, 0.95, 18.60, 26.40, -1.0, +1.0), 5.7200653e-13, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_branching_ratio(0.02, 1.95, 15.00, 26.40, -1.0, +1.0), 8.8931904e-12, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_forward_backward_asymmetry(0.02, 0.95, 18.60, 26.40), -0.22715,       eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_forward_backward_asymmetry(0.02, 1.95, 15.00, 26.40), -0.10447,       eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_branching_ratio(0.02, 0.95, 18.60, 26.40, -1.0, +1.0), 5.7057427e-13, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_branching_ratio(0.02, 1.95, 15.00, 26.40, -1.0, +1.0), 8.9239347e-12, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_forward_backward_asymmetry(0.02, 0.95, 18.60, 26.40), -0.2273996,     eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_forward_backward_asymmetry(0.02, 1.95, 15.00, 26.40), -0.1064584,     eps);
             }
         }
 } b_to_pi_pi_l_nu_test;
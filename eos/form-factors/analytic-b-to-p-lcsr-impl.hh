@@ -25,15 +25,19 @@
 #include <eos/form-factors/analytic-b-to-p-lcsr.hh>
 #include <eos/form-factors/b-lcdas.hh>
 #include <eos/utils/exception.hh>
-#include <eos/utils/integrate.hh>
+#include <eos/utils/integrate-impl.hh>
 #include <eos/utils/kinematic.hh>
+#include <eos/utils/lock.hh>
 #include <eos/utils/model.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/qcd.hh>
 #include <eos/utils/stringify.hh>
 
+#include <array>
 #include <functional>
+#include <map>
 
 namespace eos
 {
@@ -81,6 +85,45 @@ namespace eos
         std::function<double (const Implementation *, const double &, const double &)> integrand_fT_2pt;
         bool switch_borel;
 
+        // parameters, whose generation identifies the cached sum rules
+        Parameters parameters;
+
+        /*
+         * The terms of the Borel-transformed sum rule for one form factor, and of its first moment.
+         */
+        struct SumRuleTerms
+        {
+            double (Implementation::*integrand_2pt)(const double &, const double &) const;
+            double (Implementation::*integrand_2pt_m1)(const double &, const double &) const;
+            double (Implementation::*surface_2pt)(const double &, const double &) const;
+            double (Implementation::*surface_2pt_m1)(const double &, const double &) const;
+            double (Implementation::*integrand_3pt)(const std::array<double, 3> &, const double &) const;
+            double (Implementation::*integrand_3pt_m1)(const std::array<double, 3> &, const double &) const;
+            double (Implementation::*surface_3pt_A)(const std::array<double, 2> &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_A_m1)(const std::array<double, 2> &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_B)(const double &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_B_m1)(const double &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_C)(const double &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_C_m1)(const double &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_D)(const double &, const double &) const;
+            double (Implementation::*surface_3pt_D_m1)(const double &, const double &) const;
+        };
+
+        /*
+         * Results of sum_rule_and_moment for one form factor, keyed on q2. All entries
+         * belong to the parameter generation recorded alongside.
+         */
+        struct SumRuleCache
+        {
+            Parameters::Generation generation = 0;
+            std::map<double, std::array<double, 2>> values;
+        };
+
+        // cached sum rules and first moments
+        mutable SumRuleCache sum_rule_cache_fp;
+        mutable SumRuleCache sum_rule_cache_fpm;
+        mutable SumRuleCache sum_rule_cache_fT;
+        mutable Mutex sum_rule_mutex;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make("SM", p, o)),
@@ -103,7 +146,8 @@ namespace eos
             switch_2pt_g(1.0),
             switch_3pt(1.0),
             opt_method(o, "method", { "borel", "dispersive" }, "borel"),
-            switch_borel(opt_method.value() == "borel")
+            switch_borel(opt_method.value() == "borel"),
+            parameters(p)
         {
             u.uses(b_lcdas);
 
@@ -344,6 +388,97 @@ namespace eos
             return sigma(s0, q2);
         }
 
+        /* sum rules and their first moments */
+        // {{{
+        // maximal number of q2 values in each cache
+        static constexpr std::size_t sum_rule_cache_size = 64;
+
+        /*
+         * Evaluate one Borel-transformed sum rule, or the numerator of its normalized first moment.
+         */
+        double sum_rule(double (Implementation::*integrand_2pt)(const double &, const double &) const,
+                double (Implementation::*surface_2pt)(const double &, const double &) const,
+                double (Implementation::*integrand_3pt)(const std::array<double, 3> &, const double &) const,
+                double (Implementation::*surface_3pt_A)(const std::array<double, 2> &, const double &, const double &) const,
+                double (Implementation::*surface_3pt_B)(const double &, const double &, const double &) const,
+                double (Implementation::*surface_3pt_C)(const double &, const double &, const double &) const,
+                double (Implementation::*surface_3pt_D)(const double &, const double &) const,
+                const double & sigma_0, const double & q2) const
+        {
+            const std::function<double (const double &)> integrand_2pt_f = std::bind(integrand_2pt, this, std::placeholders::_1, q2);
+
+            double result = integrate<GSL::QAGS>(integrand_2pt_f, 0.0, sigma_0) - (this->*surface_2pt)(sigma_0, q2);
+
+            if (switch_3pt != 0.0)
+            {
+                const std::function<double (const std::array<double, 3> &)> integrand_3pt_f = std::bind(integrand_3pt, this, std::placeholders::_1, q2);
+                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_f = std::bind(surface_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const double &)> surface_3pt_B_f = std::bind(surface_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const double &)> surface_3pt_C_f = std::bind(surface_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+
+                result += integrate(integrand_3pt_f, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config())
+                        - integrate(surface_3pt_A_f, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
+                        - integrate<GSL::QAGS>(surface_3pt_B_f, 0.0, 1.0)                            // integrate over x_1
+                        - integrate<GSL::QAGS>(surface_3pt_C_f, 0.0, 1.0)                            // integrate over x_2
+                        - (this->*surface_3pt_D)(sigma_0, q2);
+            }
+
+            return result;
+        }
+
+        /*
+         * Evaluate the sum rule and the numerator of its normalized first moment together. Each
+         * integral is evaluated separately, such that the sum rule is independent of the moment.
+         */
+        std::array<double, 2> sum_rule_and_moment(const SumRuleTerms & t, const double & sigma_0, const double & q2) const
+        {
+            return {{
+                sum_rule(t.integrand_2pt, t.surface_2pt, t.integrand_3pt,
+                        t.surface_3pt_A, t.surface_3pt_B, t.surface_3pt_C, t.surface_3pt_D, sigma_0, q2),
+                sum_rule(t.integrand_2pt_m1, t.surface_2pt_m1, t.integrand_3pt_m1,
+                        t.surface_3pt_A_m1, t.surface_3pt_B_m1, t.surface_3pt_C_m1, t.surface_3pt_D_m1, sigma_0, q2)
+            }};
+        }
+
+        /*
+         * As sum_rule_and_moment, but reuse the results for the same q2 as long as no parameter has changed.
+         */
+        std::array<double, 2> cached_sum_rule_and_moment(SumRuleCache & cache, const SumRuleTerms & t, const double & sigma_0, const double & q2) const
+        {
+            const Parameters::Generation generation = parameters.generation();
+
+            {
+                Lock l(sum_rule_mutex);
+
+                if (cache.generation != generation)
+                {
+                    cache.values.clear();
+                    cache.generation = generation;
+                }
+
+                auto i = cache.values.find(q2);
+                if (cache.values.end() != i)
+                    return i->second;
+            }
+
+            const std::array<double, 2> result = sum_rule_and_moment(t, sigma_0, q2);
+
+            {
+                Lock l(sum_rule_mutex);
+
+                if (cache.generation == generation)
+                {
+                    if (cache.values.size() >= sum_rule_cache_size)
+                        cache.values.clear();
+
+                    cache.values.emplace(q2, result);
+                }
+            }
+
+            return result;
+        }
+        // }}}
+
         /* f_+ : 2-particle functions */
 
         inline
@@ -2713,10 +2848,32 @@ namespace eos
 
         /* f_+ : form factor and moments */
         // {{{
+        std::array<double, 2> sum_rule_fp(const double & sigma_0, const double & q2) const
+        {
+            static const SumRuleTerms terms
+            {
+                &Implementation::integrand_fp_2pt_borel, &Implementation::integrand_fp_2pt_borel_m1,
+                &Implementation::surface_fp_2pt, &Implementation::surface_fp_2pt_m1,
+                &Implementation::integrand_fp_3pt, &Implementation::integrand_fp_3pt_m1,
+                &Implementation::surface_fp_3pt_A, &Implementation::surface_fp_3pt_A_m1,
+                &Implementation::surface_fp_3pt_B, &Implementation::surface_fp_3pt_B_m1,
+                &Implementation::surface_fp_3pt_C, &Implementation::surface_fp_3pt_C_m1,
+                &Implementation::surface_fp_3pt_D, &Implementation::surface_fp_3pt_D_m1
+            };
+
+            return cached_sum_rule_and_moment(sum_rule_cache_fp, terms, sigma_0, q2);
+        }
+
         double f_p(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_p(), s0_1_p());
 
+            const double prefactor = f_B() * m_B() / f_P() / Process_::chi2;
+
+            // the Borel-transformed sum rule is shared with the first moment
+            if (switch_borel)
+                return prefactor * sum_rule_fp(sigma_0, q2)[0];
+
             const std::function<double (const double &)> integrand_2pt = std::bind(integrand_fp_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
@@ -2740,63 +2897,16 @@ namespace eos
                              - surface_fp_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * m_B() / f_P() * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return prefactor * (integral_2pt + surface_2pt + integral_3pt + surface_3pt);
         }
 
         double normalized_moment_1_f_p(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_p(), s0_1_p());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_fp_2pt_borel_m1, this, std::placeholders::_1, q2);
-
-
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_fp_2pt_borel, this, std::placeholders::_1, q2);
-
-            const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
-            const double surface_2pt_m1  = 0.0 - surface_fp_2pt_m1(sigma_0, q2);
-
-            double integral_3pt_m1 = 0.0;
-            double surface_3pt_m1  = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_fp_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_fp_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_fp_3pt_m1, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_fp_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt_m1 = integrate(integrand_3pt_m1, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt_m1  = 0.0
-                                - integrate(surface_3pt_A_m1, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B_m1, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C_m1, 0.0, 1.0)                            // integrate over x_2
-                                - surface_fp_3pt_D_m1(sigma_0, q2);
-            }
-            const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
-
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_fp_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
+            const std::array<double, 2> sum_rule = sum_rule_fp(sigma_0, q2);
 
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_fp_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_fp_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_fp_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_fp_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_fp_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
-
-            return numerator / denominator;
+            return sum_rule[1] / sum_rule[0];
         }
         // }}}
 
@@ -5452,10 +5562,32 @@ namespace eos
 
         /* f_+ : form factor and moments */
         // {{{
+        std::array<double, 2> sum_rule_fpm(const double & sigma_0, const double & q2) const
+        {
+            static const SumRuleTerms terms
+            {
+                &Implementation::integrand_fpm_2pt_borel, &Implementation::integrand_fpm_2pt_borel_m1,
+                &Implementation::surface_fpm_2pt, &Implementation::surface_fpm_2pt_m1,
+                &Implementation::integrand_fpm_3pt, &Implementation::integrand_fpm_3pt_m1,
+                &Implementation::surface_fpm_3pt_A, &Implementation::surface_fpm_3pt_A_m1,
+                &Implementation::surface_fpm_3pt_B, &Implementation::surface_fpm_3pt_B_m1,
+                &Implementation::surface_fpm_3pt_C, &Implementation::surface_fpm_3pt_C_m1,
+                &Implementation::surface_fpm_3pt_D, &Implementation::surface_fpm_3pt_D_m1
+            };
+
+            return cached_sum_rule_and_moment(sum_rule_cache_fpm, terms, sigma_0, q2);
+        }
+
         double f_pm(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_pm(), s0_1_pm());
 
+            const double prefactor = f_B() * m_B() / f_P() / Process_::chi2;
+
+            // the Borel-transformed sum rule is shared with the first moment
+            if (switch_borel)
+                return prefactor * sum_rule_fpm(sigma_0, q2)[0];
+
             const std::function<double (const double &)> integrand_2pt = std::bind(integrand_fpm_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
@@ -5479,63 +5611,16 @@ namespace eos
                              - surface_fpm_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * m_B() / f_P() * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return prefactor * (integral_2pt + surface_2pt + integral_3pt + surface_3pt);
         }
 
         double normalized_moment_1_f_pm(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_pm(), s0_1_pm());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_fpm_2pt_borel_m1, this, std::placeholders::_1, q2);
-
+            const std::array<double, 2> sum_rule = sum_rule_fpm(sigma_0, q2);
 
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_fpm_2pt_borel, this, std::placeholders::_1, q2);
-
-            const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
-            const double surface_2pt_m1  = 0.0 - surface_fpm_2pt_m1(sigma_0, q2);
-
-            double integral_3pt_m1 = 0.0;
-            double surface_3pt_m1  = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_fpm_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_fpm_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_fpm_3pt_m1, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_fpm_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt_m1 = integrate(integrand_3pt_m1, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt_m1  = 0.0
-                                - integrate(surface_3pt_A_m1, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B_m1, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C_m1, 0.0, 1.0)                            // integrate over x_2
-                                - surface_fpm_3pt_D_m1(sigma_0, q2);
-            }
-            const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
-
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_fpm_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_fpm_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_fpm_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_fpm_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_fpm_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_fpm_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
-
-            return numerator / denominator;
+            return sum_rule[1] / sum_rule[0];
         }
         // }}}
 
@@ -8327,10 +8412,32 @@ namespace eos
 
         /* fT : form factor and moments */
         // {{{
+        std::array<double, 2> sum_rule_fT(const double & sigma_0, const double & q2) const
+        {
+            static const SumRuleTerms terms
+            {
+                &Implementation::integrand_fT_2pt_borel, &Implementation::integrand_fT_2pt_borel_m1,
+                &Implementation::surface_fT_2pt, &Implementation::surface_fT_2pt_m1,
+                &Implementation::integrand_fT_3pt, &Implementation::integrand_fT_3pt_m1,
+                &Implementation::surface_fT_3pt_A, &Implementation::surface_fT_3pt_A_m1,
+                &Implementation::surface_fT_3pt_B, &Implementation::surface_fT_3pt_B_m1,
+                &Implementation::surface_fT_3pt_C, &Implementation::surface_fT_3pt_C_m1,
+                &Implementation::surface_fT_3pt_D, &Implementation::surface_fT_3pt_D_m1
+            };
+
+            return cached_sum_rule_and_moment(sum_rule_cache_fT, terms, sigma_0, q2);
+        }
+
         double f_t(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_t(), s0_1_t());
 
+            const double prefactor = f_B() * pow(m_B(), 2) * (m_B() + m_P()) / (f_P() * (pow(m_B(), 2) - pow(m_P(), 2) - q2)) / Process_::chi2;
+
+            // the Borel-transformed sum rule is shared with the first moment
+            if (switch_borel)
+                return prefactor * sum_rule_fT(sigma_0, q2)[0];
+
             const std::function<double (const double &)> integrand_2pt = std::bind(integrand_fT_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
@@ -8354,63 +8461,16 @@ namespace eos
                              - surface_fT_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * pow(m_B(), 2) * (m_B() + m_P()) / (f_P() * (pow(m_B(), 2) - pow(m_P(), 2) - q2)) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return prefactor * (integral_2pt + surface_2pt + integral_3pt + surface_3pt);
         }
 
         double normalized_moment_1_f_t(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_t(), s0_1_t());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_fT_2pt_borel_m1, this, std::placeholders::_1, q2);
-
-
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_fT_2pt_borel, this, std::placeholders::_1, q2);
-
-            const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
-            const double surface_2pt_m1  = 0.0 - surface_fT_2pt_m1(sigma_0, q2);
-
-            double integral_3pt_m1 = 0.0;
-            double surface_3pt_m1  = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_fT_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_fT_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_fT_3pt_m1, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_fT_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt_m1 = integrate(integrand_3pt_m1, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt_m1  = 0.0
-                                - integrate(surface_3pt_A_m1, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B_m1, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C_m1, 0.0, 1.0)                            // integrate over x_2
-                                - surface_fT_3pt_D_m1(sigma_0, q2);
-            }
-            const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
-
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_fT_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_fT_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_fT_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_fT_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_fT_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_fT_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            const std::array<double, 2> sum_rule = sum_rule_fT(sigma_0, q2);
 
-            return numerator / denominator;
+            return sum_rule[1] / sum_rule[0];
         }
         // }}}
 
@@ -27,13 +27,17 @@
 #include <eos/utils/exception.hh>
 #include <eos/utils/integrate-impl.hh>
 #include <eos/utils/kinematic.hh>
+#include <eos/utils/lock.hh>
 #include <eos/utils/model.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/qcd.hh>
 #include <eos/utils/stringify.hh>
 
+#include <array>
 #include <functional>
+#include <map>
 
 #include <iostream>
 
@@ -95,6 +99,54 @@ namespace eos
         std::function<double (const Implementation *, const double &, const double &)> integrand_t23B_2pt;
         bool switch_borel;
 
+        // switch to select the cubature backend for the three-particle contributions
+        SwitchOption opt_integration_3pt;
+        cubature::Config config_3pt;
+
+        // parameters, whose generation identifies the cached sum rules
+        Parameters parameters;
+
+        /*
+         * The terms of the Borel-transformed sum rule for one form factor, and of its first moment.
+         */
+        struct SumRuleTerms
+        {
+            double (Implementation::*integrand_2pt)(const double &, const double &) const;
+            double (Implementation::*integrand_2pt_m1)(const double &, const double &) const;
+            double (Implementation::*surface_2pt)(const double &, const double &) const;
+            double (Implementation::*surface_2pt_m1)(const double &, const double &) const;
+            double (Implementation::*integrand_3pt)(const std::array<double, 3> &, const double &) const;
+            double (Implementation::*integrand_3pt_m1)(const std::array<double, 3> &, const double &) const;
+            double (Implementation::*surface_3pt_A)(const std::array<double, 2> &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_A_m1)(const std::array<double, 2> &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_B)(const double &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_B_m1)(const double &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_C)(const double &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_C_m1)(const double &, const double &, const double &) const;
+            double (Implementation::*surface_3pt_D)(const double &, const double &) const;
+            double (Implementation::*surface_3pt_D_m1)(const double &, const double &) const;
+        };
+
+        /*
+         * Results of sum_rule_and_moment for one form factor, keyed on q2. All entries
+         * belong to the parameter generation recorded alongside.
+         */
+        struct SumRuleCache
+        {
+            Parameters::Generation generation = 0;
+            std::map<double, std::array<double, 2>> values;
+        };
+
+        // cached sum rules and first moments
+        mutable SumRuleCache sum_rule_cache_A1;
+        mutable SumRuleCache sum_rule_cache_A2;
+        mutable SumRuleCache sum_rule_cache_A30;
+        mutable SumRuleCache sum_rule_cache_V;
+        mutable SumRuleCache sum_rule_cache_T1;
+        mutable SumRuleCache sum_rule_cache_T23A;
+        mutable SumRuleCache sum_rule_cache_T23B;
+        mutable Mutex sum_rule_mutex;
+
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make("SM", p, o)),
             m_B(p[Process_::m_B], u),
@@ -124,7 +176,10 @@ namespace eos
             switch_2pt_g(1.0),
             switch_3pt(1.0),
             opt_method(o, "method", { "borel", "dispersive" }, "borel"),
-            switch_borel(opt_method.value() == "borel")
+            switch_borel(opt_method.value() == "borel"),
+            opt_integration_3pt(o, "integration-3pt", { "hcubature", "lattice" }, "hcubature"),
+            config_3pt(cubature::Config().backend("lattice" == opt_integration_3pt.value() ? cubature::Backend::lattice : cubature::Backend::hcubature)),
+            parameters(p)
         {
             u.uses(b_lcdas);
 
@@ -402,6 +457,97 @@ namespace eos
         }
         // }}}
 
+        /* sum rules and their first moments */
+        // {{{
+        // maximal number of q2 values in each cache
+        static constexpr std::size_t sum_rule_cache_size = 64;
+
+        /*
+         * Evaluate one Borel-transformed sum rule, or the numerator of its normalized first moment.
+         */
+        double sum_rule(double (Implementation::*integrand_2pt)(const double &, const double &) const,
+                double (Implementation::*surface_2pt)(const double &, const double &) const,
+                double (Implementation::*integrand_3pt)(const std::array<double, 3> &, const double &) const,
+                double (Implementation::*surface_3pt_A)(const std::array<double, 2> &, const double &, const double &) const,
+                double (Implementation::*surface_3pt_B)(const double &, const double &, const double &) const,
+                double (Implementation::*surface_3pt_C)(const double &, const double &, const double &) const,
+                double (Implementation::*surface_3pt_D)(const double &, const double &) const,
+                const double & sigma_0, const double & q2) const
+        {
+            const std::function<double (const double &)> integrand_2pt_f = std::bind(integrand_2pt, this, std::placeholders::_1, q2);
+
+            double result = integrate<GSL::QAGS>(integrand_2pt_f, 0.0, sigma_0) - (this->*surface_2pt)(sigma_0, q2);
+
+            if (switch_3pt != 0.0)
+            {
+                const std::function<double (const std::array<double, 3> &)> integrand_3pt_f = std::bind(integrand_3pt, this, std::placeholders::_1, q2);
+                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_f = std::bind(surface_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const double &)> surface_3pt_B_f = std::bind(surface_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const double &)> surface_3pt_C_f = std::bind(surface_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+
+                result += integrate(integrand_3pt_f, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, config_3pt)
+                        - integrate(surface_3pt_A_f, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
+                        - integrate<GSL::QAGS>(surface_3pt_B_f, 0.0, 1.0)                            // integrate over x_1
+                        - integrate<GSL::QAGS>(surface_3pt_C_f, 0.0, 1.0)                            // integrate over x_2
+                        - (this->*surface_3pt_D)(sigma_0, q2);
+            }
+
+            return result;
+        }
+
+        /*
+         * Evaluate the sum rule and the numerator of its normalized first moment together. Each
+         * integral is evaluated separately, such that the sum rule is independent of the moment.
+         */
+        std::array<double, 2> sum_rule_and_moment(const SumRuleTerms & t, const double & sigma_0, const double & q2) const
+        {
+            return {{
+                sum_rule(t.integrand_2pt, t.surface_2pt, t.integrand_3pt,
+                        t.surface_3pt_A, t.surface_3pt_B, t.surface_3pt_C, t.surface_3pt_D, sigma_0, q2),
+                sum_rule(t.integrand_2pt_m1, t.surface_2pt_m1, t.integrand_3pt_m1,
+                        t.surface_3pt_A_m1, t.surface_3pt_B_m1, t.surface_3pt_C_m1, t.surface_3pt_D_m1, sigma_0, q2)
+            }};
+        }
+
+        /*
+         * As sum_rule_and_moment, but reuse the results for the same q2 as long as no parameter has changed.
+         */
+        std::array<double, 2> cached_sum_rule_and_moment(SumRuleCache & cache, const SumRuleTerms & t, const double & sigma_0, const double & q2) const
+        {
+            const Parameters::Generation generation = parameters.generation();
+
+            {
+                Lock l(sum_rule_mutex);
+
+                if (cache.generation != generation)
+                {
+                    cache.values.clear();
+                    cache.generation = generation;
+                }
+
+                auto i = cache.values.find(q2);
+                if (cache.values.end() != i)
+                    return i->second;
+            }
+
+            const std::array<double, 2> result = sum_rule_and_moment(t, sigma_0, q2);
+
+            {
+                Lock l(sum_rule_mutex);
+
+                if (cache.generation == generation)
+                {
+                    if (cache.values.size() >= sum_rule_cache_size)
+                        cache.values.clear();
+
+                    cache.values.emplace(q2, result);
+                }
+            }
+
+            return result;
+        }
+        // }}}
+
         /* A_1 : 2-particle functions */
         // {{{
         inline
@@ -3700,10 +3846,32 @@ namespace eos
 
         /* A1 : form factor and moments */
         // {{{
+        std::array<double, 2> sum_rule_A1(const double & sigma_0, const double & q2) const
+        {
+            static const SumRuleTerms terms
+            {
+                &Implementation::integrand_A1_2pt_borel, &Implementation::integrand_A1_2pt_borel_m1,
+                &Implementation::surface_A1_2pt, &Implementation::surface_A1_2pt_m1,
+                &Implementation::integrand_A1_3pt, &Implementation::integrand_A1_3pt_m1,
+                &Implementation::surface_A1_3pt_A, &Implementation::surface_A1_3pt_A_m1,
+                &Implementation::surface_A1_3pt_B, &Implementation::surface_A1_3pt_B_m1,
+                &Implementation::surface_A1_3pt_C, &Implementation::surface_A1_3pt_C_m1,
+                &Implementation::surface_A1_3pt_D, &Implementation::surface_A1_3pt_D_m1
+            };
+
+            return cached_sum_rule_and_moment(sum_rule_cache_A1, terms, sigma_0, q2);
+        }
+
         double a_1(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A1(), s0_1_A1());
 
+            const double prefactor = f_B() * pow(m_B(), 3) / (2.0 * f_V() * m_V * (m_B + m_V)) / Process_::chi2;
+
+            // the Borel-transformed sum rule is shared with the first moment
+            if (switch_borel)
+                return prefactor * sum_rule_A1(sigma_0, q2)[0];
+
             const std::function<double (const double &)> integrand_2pt = std::bind(integrand_a1_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
@@ -3719,7 +3887,7 @@ namespace eos
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A1_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A1_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
-                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, config_3pt);
                 surface_3pt  = 0.0
                              - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
                              - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
@@ -3727,63 +3895,16 @@ namespace eos
                              - surface_A1_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * pow(m_B(), 3) / (2.0 * f_V() * m_V * (m_B + m_V)) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return prefactor * (integral_2pt + surface_2pt + integral_3pt + surface_3pt);
         }
 
         double normalized_moment_1_a_1(const double & q2) const
         {
-            const double sigma_0 = this->sigma_0(q2, s0_0_A1(), s0_1_A1()) ;
-
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A1_2pt_borel_m1, this, std::placeholders::_1, q2);
-
-
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A1_2pt_borel, this, std::placeholders::_1, q2);
-
-            const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
-            const double surface_2pt_m1  = 0.0 - surface_A1_2pt_m1(sigma_0, q2);
-
-            double integral_3pt_m1 = 0.0;
-            double surface_3pt_m1  = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_A1_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_A1_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_A1_3pt_m1, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_A1_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt_m1 = integrate(integrand_3pt_m1, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt_m1  = 0.0
-                                - integrate(surface_3pt_A_m1, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B_m1, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C_m1, 0.0, 1.0)                            // integrate over x_2
-                                - surface_A1_3pt_D_m1(sigma_0, q2);
-            }
-            const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
-
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_A1_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_A1_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_A1_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A1_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A1_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+            const double sigma_0 = this->sigma_0(q2, s0_0_A1(), s0_1_A1());
 
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_A1_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            const std::array<double, 2> sum_rule = sum_rule_A1(sigma_0, q2);
 
-            return numerator / denominator;
+            return sum_rule[1] / sum_rule[0];
         }
         // }}}
 
@@ -6456,10 +6577,32 @@ namespace eos
 
         /* A2 : form factor and moments */
         // {{{
+        std::array<double, 2> sum_rule_A2(const double & sigma_0, const double & q2) const
+        {
+            static const SumRuleTerms terms
+            {
+                &Implementation::integrand_A2_2pt_borel, &Implementation::integrand_A2_2pt_borel_m1,
+                &Implementation::surface_A2_2pt, &Implementation::surface_A2_2pt_m1,
+                &Implementation::integrand_A2_3pt, &Implementation::integrand_A2_3pt_m1,
+                &Implementation::surface_A2_3pt_A, &Implementation::surface_A2_3pt_A_m1,
+                &Implementation::surface_A2_3pt_B, &Implementation::surface_A2_3pt_B_m1,
+                &Implementation::surface_A2_3pt_C, &Implementation::surface_A2_3pt_C_m1,
+                &Implementation::surface_A2_3pt_D, &Implementation::surface_A2_3pt_D_m1
+            };
+
+            return cached_sum_rule_and_moment(sum_rule_cache_A2, terms, sigma_0, q2);
+        }
+
         double a_2(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A2(), s0_1_A2());
 
+            const double prefactor = f_B() * m_B() * (m_B + m_V) / (2.0 * f_V() * m_V) / Process_::chi2;
+
+            // the Borel-transformed sum rule is shared with the first moment
+            if (switch_borel)
+                return prefactor * sum_rule_A2(sigma_0, q2)[0];
+
             const std::function<double (const double &)> integrand_2pt = std::bind(integrand_a2_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
@@ -6475,7 +6618,7 @@ namespace eos
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A2_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A2_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
-                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, config_3pt);
                 surface_3pt  = 0.0
                              - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
                              - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
@@ -6483,63 +6626,16 @@ namespace eos
                              - surface_A2_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * m_B() * (m_B + m_V) / (2.0 * f_V() * m_V) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return prefactor * (integral_2pt + surface_2pt + integral_3pt + surface_3pt);
         }
 
         double normalized_moment_1_a_2(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A2(), s0_1_A2());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A2_2pt_borel_m1, this, std::placeholders::_1, q2);
-
-
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A2_2pt_borel, this, std::placeholders::_1, q2);
-
-            const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
-            const double surface_2pt_m1  = 0.0 - surface_A2_2pt_m1(sigma_0, q2);
-
-            double integral_3pt_m1 = 0.0;
-            double surface_3pt_m1  = 0.0;
+            const std::array<double, 2> sum_rule = sum_rule_A2(sigma_0, q2);
 
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_A2_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_A2_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_A2_3pt_m1, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_A2_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt_m1 = integrate(integrand_3pt_m1, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt_m1  = 0.0
-                                - integrate(surface_3pt_A_m1, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B_m1, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C_m1, 0.0, 1.0)                            // integrate over x_2
-                                - surface_A2_3pt_D_m1(sigma_0, q2);
-            }
-            const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
-
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_A2_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_A2_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_A2_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A2_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A2_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_A2_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
-
-            return numerator / denominator;
+            return sum_rule[1] / sum_rule[0];
         }
         // }}}
 
@@ -9208,10 +9304,32 @@ namespace eos
 
         /* A30 : form factor and moments */
         // {{{
+        std::array<double, 2> sum_rule_A30(const double & sigma_0, const double & q2) const
+        {
+            static const SumRuleTerms terms
+            {
+                &Implementation::integrand_A30_2pt_borel, &Implementation::integrand_A30_2pt_borel_m1,
+                &Implementation::surface_A30_2pt, &Implementation::surface_A30_2pt_m1,
+                &Implementation::integrand_A30_3pt, &Implementation::integrand_A30_3pt_m1,
+                &Implementation::surface_A30_3pt_A, &Implementation::surface_A30_3pt_A_m1,
+                &Implementation::surface_A30_3pt_B, &Implementation::surface_A30_3pt_B_m1,
+                &Implementation::surface_A30_3pt_C, &Implementation::surface_A30_3pt_C_m1,
+                &Implementation::surface_A30_3pt_D, &Implementation::surface_A30_3pt_D_m1
+            };
+
+            return cached_sum_rule_and_moment(sum_rule_cache_A30, terms, sigma_0, q2);
+        }
+
         double a_30(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A30(), s0_1_A30());
 
+            const double prefactor = f_B() * q2 * m_B / (4.0 * f_V() * pow(m_V, 2)) / Process_::chi2;
+
+            // the Borel-transformed sum rule is shared with the first moment
+            if (switch_borel)
+                return prefactor * sum_rule_A30(sigma_0, q2)[0];
+
             const std::function<double (const double &)> integrand_2pt = std::bind(integrand_a30_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
@@ -9227,7 +9345,7 @@ namespace eos
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A30_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A30_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
-                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, config_3pt);
                 surface_3pt  = 0.0
                              - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
                              - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
@@ -9235,63 +9353,16 @@ namespace eos
                              - surface_A30_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * q2 * m_B / (4.0 * f_V() * pow(m_V, 2)) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return prefactor * (integral_2pt + surface_2pt + integral_3pt + surface_3pt);
         }
 
         double normalized_moment_1_a_30(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A30(), s0_1_A30());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A30_2pt_borel_m1, this, std::placeholders::_1, q2);
-
-
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A30_2pt_borel, this, std::placeholders::_1, q2);
-
-            const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
-            const double surface_2pt_m1  = 0.0 - surface_A30_2pt_m1(sigma_0, q2);
-
-            double integral_3pt_m1 = 0.0;
-            double surface_3pt_m1  = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_A30_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_A30_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_A30_3pt_m1, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_A30_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt_m1 = integrate(integrand_3pt_m1, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt_m1  = 0.0
-                                - integrate(surface_3pt_A_m1, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B_m1, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C_m1, 0.0, 1.0)                            // integrate over x_2
-                                - surface_A30_3pt_D_m1(sigma_0, q2);
-            }
-            const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
-
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_A30_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_A30_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_A30_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A30_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A30_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_A30_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            const std::array<double, 2> sum_rule = sum_rule_A30(sigma_0, q2);
 
-            return numerator / denominator;
+            return sum_rule[1] / sum_rule[0];
         }
         // }}}
 
@@ -11537,10 +11608,32 @@ namespace eos
 
         /* V : form factor and moments */
         // {{{
+        std::array<double, 2> sum_rule_V(const double & sigma_0, const double & q2) const
+        {
+            static const SumRuleTerms terms
+            {
+                &Implementation::integrand_V_2pt_borel, &Implementation::integrand_V_2pt_borel_m1,
+                &Implementation::surface_V_2pt, &Implementation::surface_V_2pt_m1,
+                &Implementation::integrand_V_3pt, &Implementation::integrand_V_3pt_m1,
+                &Implementation::surface_V_3pt_A, &Implementation::surface_V_3pt_A_m1,
+                &Implementation::surface_V_3pt_B, &Implementation::surface_V_3pt_B_m1,
+                &Implementation::surface_V_3pt_C, &Implementation::surface_V_3pt_C_m1,
+                &Implementation::surface_V_3pt_D, &Implementation::surface_V_3pt_D_m1
+            };
+
+            return cached_sum_rule_and_moment(sum_rule_cache_V, terms, sigma_0, q2);
+        }
+
         double v(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_V(), s0_1_V());
 
+            const double prefactor = f_B() * pow(m_B, 2) * (m_B + m_V) / (2.0 * f_V() * m_V) / Process_::chi2;
+
+            // the Borel-transformed sum rule is shared with the first moment
+            if (switch_borel)
+                return prefactor * sum_rule_V(sigma_0, q2)[0];
+
             const std::function<double (const double &)> integrand_2pt = std::bind(integrand_v_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
@@ -11556,7 +11649,7 @@ namespace eos
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_V_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_V_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
-                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, config_3pt);
                 surface_3pt  = 0.0
                              - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
                              - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
@@ -11564,63 +11657,16 @@ namespace eos
                              - surface_V_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * pow(m_B, 2) * (m_B + m_V) / (2.0 * f_V() * m_V) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return prefactor * (integral_2pt + surface_2pt + integral_3pt + surface_3pt);
         }
 
         double normalized_moment_1_v(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_V(), s0_1_V());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_V_2pt_borel_m1, this, std::placeholders::_1, q2);
-
-
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_V_2pt_borel, this, std::placeholders::_1, q2);
-
-            const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
-            const double surface_2pt_m1  = 0.0 - surface_V_2pt_m1(sigma_0, q2);
-
-            double integral_3pt_m1 = 0.0;
-            double surface_3pt_m1  = 0.0;
+            const std::array<double, 2> sum_rule = sum_rule_V(sigma_0, q2);
 
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_V_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_V_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_V_3pt_m1, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_V_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt_m1 = integrate(integrand_3pt_m1, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt_m1  = 0.0
-                                - integrate(surface_3pt_A_m1, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B_m1, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C_m1, 0.0, 1.0)                            // integrate over x_2
-                                - surface_V_3pt_D_m1(sigma_0, q2);
-            }
-            const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
-
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_V_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_V_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_V_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_V_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_V_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_V_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
-
-            return numerator / denominator;
+            return sum_rule[1] / sum_rule[0];
         }
         // }}}
 
@@ -14186,10 +14232,32 @@ namespace eos
 
         /* T1 : form factor and moments */
         // {{{
+        std::array<double, 2> sum_rule_T1(const double & sigma_0, const double & q2) const
+        {
+            static const SumRuleTerms terms
+            {
+                &Implementation::integrand_T1_2pt_borel, &Implementation::integrand_T1_2pt_borel_m1,
+                &Implementation::surface_T1_2pt, &Implementation::surface_T1_2pt_m1,
+                &Implementation::integrand_T1_3pt, &Implementation::integrand_T1_3pt_m1,
+                &Implementation::surface_T1_3pt_A, &Implementation::surface_T1_3pt_A_m1,
+                &Implementation::surface_T1_3pt_B, &Implementation::surface_T1_3pt_B_m1,
+                &Implementation::surface_T1_3pt_C, &Implementation::surface_T1_3pt_C_m1,
+                &Implementation::surface_T1_3pt_D, &Implementation::surface_T1_3pt_D_m1
+            };
+
+            return cached_sum_rule_and_moment(sum_rule_cache_T1, terms, sigma_0, q2);
+        }
+
         double t_1(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T1(), s0_1_T1());
 
+            const double prefactor = f_B() * pow(m_B(), 2) / (2.0 * f_V() * m_V) / Process_::chi2;
+
+            // the Borel-transformed sum rule is shared with the first moment
+            if (switch_borel)
+                return prefactor * sum_rule_T1(sigma_0, q2)[0];
+
             const std::function<double (const double &)> integrand_2pt = std::bind(integrand_t1_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
@@ -14205,7 +14273,7 @@ namespace eos
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T1_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T1_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
-                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, config_3pt);
                 surface_3pt  = 0.0
                              - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
                              - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
@@ -14213,63 +14281,16 @@ namespace eos
                              - surface_T1_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * pow(m_B(), 2) / (2.0 * f_V() * m_V) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return prefactor * (integral_2pt + surface_2pt + integral_3pt + surface_3pt);
         }
 
         double normalized_moment_1_t_1(const double & q2) const
         {
-            const double sigma_0 = this->sigma_0(q2, s0_0_T1(), s0_1_T1()) ;
-
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T1_2pt_borel_m1, this, std::placeholders::_1, q2);
-
-
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T1_2pt_borel, this, std::placeholders::_1, q2);
-
-            const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
-            const double surface_2pt_m1  = 0.0 - surface_T1_2pt_m1(sigma_0, q2);
-
-            double integral_3pt_m1 = 0.0;
-            double surface_3pt_m1  = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_T1_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_T1_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_T1_3pt_m1, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_T1_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt_m1 = integrate(integrand_3pt_m1, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt_m1  = 0.0
-                                - integrate(surface_3pt_A_m1, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B_m1, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C_m1, 0.0, 1.0)                            // integrate over x_2
-                                - surface_T1_3pt_D_m1(sigma_0, q2);
-            }
-            const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
-
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_T1_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_T1_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_T1_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T1_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T1_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+            const double sigma_0 = this->sigma_0(q2, s0_0_T1(), s0_1_T1());
 
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_T1_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            const std::array<double, 2> sum_rule = sum_rule_T1(sigma_0, q2);
 
-            return numerator / denominator;
+            return sum_rule[1] / sum_rule[0];
         }
         // }}}
 
@@ -17076,10 +17097,32 @@ namespace eos
 
         /* T23A : form factor and moments */
         // {{{
+        std::array<double, 2> sum_rule_T23A(const double & sigma_0, const double & q2) const
+        {
+            static const SumRuleTerms terms
+            {
+                &Implementation::integrand_T23A_2pt_borel, &Implementation::integrand_T23A_2pt_borel_m1,
+                &Implementation::surface_T23A_2pt, &Implementation::surface_T23A_2pt_m1,
+                &Implementation::integrand_T23A_3pt, &Implementation::integrand_T23A_3pt_m1,
+                &Implementation::surface_T23A_3pt_A, &Implementation::surface_T23A_3pt_A_m1,
+                &Implementation::surface_T23A_3pt_B, &Implementation::surface_T23A_3pt_B_m1,
+                &Implementation::surface_T23A_3pt_C, &Implementation::surface_T23A_3pt_C_m1,
+                &Implementation::surface_T23A_3pt_D, &Implementation::surface_T23A_3pt_D_m1
+            };
+
+            return cached_sum_rule_and_moment(sum_rule_cache_T23A, terms, sigma_0, q2);
+        }
+
         double t_23A(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T23A(), s0_1_T23A());
 
+            const double prefactor = f_B() * pow(m_B(), 2) / (2.0 * f_V() * m_V) / Process_::chi2;
+
+            // the Borel-transformed sum rule is shared with the first moment
+            if (switch_borel)
+                return prefactor * sum_rule_T23A(sigma_0, q2)[0];
+
             const std::function<double (const double &)> integrand_2pt = std::bind(integrand_t23A_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
@@ -17095,7 +17138,7 @@ namespace eos
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T23A_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T23A_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
-                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, config_3pt);
                 surface_3pt  = 0.0
                              - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
                              - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
@@ -17103,63 +17146,16 @@ namespace eos
                              - surface_T23A_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * pow(m_B(), 2) / (2.0 * f_V() * m_V) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return prefactor * (integral_2pt + surface_2pt + integral_3pt + surface_3pt);
         }
 
         double normalized_moment_1_t_23A(const double & q2) const
         {
-            const double sigma_0 = this->sigma_0(q2, s0_0_T23A(), s0_1_T23A()) ;
-
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T23A_2pt_borel_m1, this, std::placeholders::_1, q2);
-
-
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T23A_2pt_borel, this, std::placeholders::_1, q2);
-
-            const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
-            const double surface_2pt_m1  = 0.0 - surface_T23A_2pt_m1(sigma_0, q2);
-
-            double integral_3pt_m1 = 0.0;
-            double surface_3pt_m1  = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_T23A_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_T23A_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_T23A_3pt_m1, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_T23A_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt_m1 = integrate(integrand_3pt_m1, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt_m1  = 0.0
-                                - integrate(surface_3pt_A_m1, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B_m1, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C_m1, 0.0, 1.0)                            // integrate over x_2
-                                - surface_T23A_3pt_D_m1(sigma_0, q2);
-            }
-            const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
-
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_T23A_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_T23A_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_T23A_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T23A_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T23A_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+            const double sigma_0 = this->sigma_0(q2, s0_0_T23A(), s0_1_T23A());
 
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_T23A_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            const std::array<double, 2> sum_rule = sum_rule_T23A(sigma_0, q2);
 
-            return numerator / denominator;
+            return sum_rule[1] / sum_rule[0];
         }
         // }}}
 
@@ -20259,10 +20255,32 @@ namespace eos
 
         /* T23B : form factor and moments */
         // {{{
+        std::array<double, 2> sum_rule_T23B(const double & sigma_0, const double & q2) const
+        {
+            static const SumRuleTerms terms
+            {
+                &Implementation::integrand_T23B_2pt_borel, &Implementation::integrand_T23B_2pt_borel_m1,
+                &Implementation::surface_T23B_2pt, &Implementation::surface_T23B_2pt_m1,
+                &Implementation::integrand_T23B_3pt, &Implementation::integrand_T23B_3pt_m1,
+                &Implementation::surface_T23B_3pt_A, &Implementation::surface_T23B_3pt_A_m1,
+                &Implementation::surface_T23B_3pt_B, &Implementation::surface_T23B_3pt_B_m1,
+                &Implementation::surface_T23B_3pt_C, &Implementation::surface_T23B_3pt_C_m1,
+                &Implementation::surface_T23B_3pt_D, &Implementation::surface_T23B_3pt_D_m1
+            };
+
+            return cached_sum_rule_and_moment(sum_rule_cache_T23B, terms, sigma_0, q2);
+        }
+
         double t_23B(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T23B(), s0_1_T23B());
 
+            const double prefactor = f_B() * pow(m_B(), 2) / (2.0 * f_V() * m_V) / Process_::chi2;
+
+            // the Borel-transformed sum rule is shared with the first moment
+            if (switch_borel)
+                return prefactor * sum_rule_T23B(sigma_0, q2)[0];
+
             const std::function<double (const double &)> integrand_2pt = std::bind(integrand_t23B_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
@@ -20278,7 +20296,7 @@ namespace eos
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T23B_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T23B_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
-                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                integral_3pt = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, config_3pt);
                 surface_3pt  = 0.0
                              - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
                              - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
@@ -20286,63 +20304,16 @@ namespace eos
                              - surface_T23B_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * pow(m_B(), 2) / (2.0 * f_V() * m_V) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return prefactor * (integral_2pt + surface_2pt + integral_3pt + surface_3pt);
         }
 
         double normalized_moment_1_t_23B(const double & q2) const
         {
-            const double sigma_0 = this->sigma_0(q2, s0_0_T23B(), s0_1_T23B()) ;
-
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T23B_2pt_borel_m1, this, std::placeholders::_1, q2);
-
-
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T23B_2pt_borel, this, std::placeholders::_1, q2);
-
-            const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
-            const double surface_2pt_m1  = 0.0 - surface_T23B_2pt_m1(sigma_0, q2);
-
-            double integral_3pt_m1 = 0.0;
-            double surface_3pt_m1  = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_T23B_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_T23B_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_T23B_3pt_m1, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_T23B_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt_m1 = integrate(integrand_3pt_m1, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt_m1  = 0.0
-                                - integrate(surface_3pt_A_m1, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B_m1, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C_m1, 0.0, 1.0)                            // integrate over x_2
-                                - surface_T23B_3pt_D_m1(sigma_0, q2);
-            }
-            const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
-
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_T23B_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_T23B_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_T23B_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T23B_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T23B_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+            const double sigma_0 = this->sigma_0(q2, s0_0_T23B(), s0_1_T23B());
 
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_T23B_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            const std::array<double, 2> sum_rule = sum_rule_T23B(sigma_0, q2);
 
-            return numerator / denominator;
+            return sum_rule[1] / sum_rule[0];
         }
         // }}}
 
@@ -0,0 +1,438 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/optimize/optimizer-lbfgs.hh>
+#include <eos/utils/density.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <exception>
+#include <limits>
+
+namespace eos
+{
+    template <>
+    struct Implementation<OptimizerLBFGS>
+    {
+        DensityPtr density;
+
+        const unsigned max_iterations;
+
+        const double tolerance;
+
+        const unsigned history;
+
+        OptimizerLBFGS::Gradient analytic_gradient;
+
+        // the density's parameters and their ranges
+        std::vector<MutablePtr> parameters;
+        std::vector<double> lower, upper;
+
+        // independent copies of the density for the finite differences, and their parameters
+        std::vector<DensityPtr> clones;
+        std::vector<std::vector<MutablePtr>> clone_parameters;
+
+        // statistics of the last optimization
+        unsigned iterations;
+        unsigned evaluations;
+        unsigned gradient_evaluations;
+
+        Implementation(const DensityPtr & density, const unsigned & max_iterations, const double & tolerance,
+                const unsigned & history, const OptimizerLBFGS::Gradient & analytic_gradient) :
+            density(density),
+            max_iterations(max_iterations),
+            tolerance(tolerance),
+            history(history),
+            analytic_gradient(analytic_gradient),
+            iterations(0),
+            evaluations(0),
+            gradient_evaluations(0)
+        {
+            if (0 == history)
+                throw OptimizerError("OptimizerLBFGS: history must contain at least one correction pair");
+
+            for (const auto & d : *density)
+            {
+                parameters.push_back(d.parameter);
+                lower.push_back(d.min);
+                upper.push_back(d.max);
+            }
+        }
+
+        // target function, i.e. sign * log(density), at the point x
+        double evaluate(const std::vector<double> & x, const double & sign)
+        {
+            density->set_point(x);
+            ++evaluations;
+
+            return sign * density->evaluate();
+        }
+
+        // gradient of the target function at the point x, where its value is f_x
+        void gradient(const std::vector<double> & x, const double & f_x, const double & sign, std::vector<double> & g)
+        {
+            ++gradient_evaluations;
+
+            const unsigned n = x.size();
+            g.resize(n);
+
+            if (analytic_gradient)
+            {
+                analytic_gradient(x, g);
+                for (auto & g_i : g)
+                {
+                    g_i *= sign;
+                }
+
+                return;
+            }
+
+            const unsigned number_of_jobs = std::max(1u, std::min(n, ThreadPool::instance()->number_of_threads()));
+
+            while (clones.size() < number_of_jobs)
+            {
+                clones.push_back(density->clone());
+                clone_parameters.push_back(std::vector<MutablePtr>());
+                for (const auto & d : *clones.back())
+                {
+                    clone_parameters.back().push_back(d.parameter);
+                }
+            }
+
+            std::vector<unsigned> job_evaluations(number_of_jobs, 0u);
+            std::vector<std::exception_ptr> exceptions(number_of_jobs);
+            std::vector<Ticket> tickets;
+            tickets.reserve(number_of_jobs);
+
+            const unsigned chunk_size = (n + number_of_jobs - 1) / number_of_jobs;
+            for (unsigned j = 0 ; j < number_of_jobs ; ++j)
+            {
+                const unsigned begin = j * chunk_size, end = std::min(n, begin + chunk_size);
+
+                tickets.push_back(ThreadPool::instance()->enqueue([this, &x, &g, &job_evaluations, &exceptions, f_x, sign, begin, end, j]()
+                {
+                    static const double cbrt_eps = std::cbrt(std::numeric_limits<double>::epsilon());
+
+                    try
+                    {
+                        const DensityPtr & clone = clones[j];
+                        const std::vector<MutablePtr> & p = clone_parameters[j];
+
+                        clone->set_point(x);
+
+                        for (unsigned i = begin ; i < end ; ++i)
+                        {
+                            // central differences, which become one-sided at the bounds
+                            const double h = cbrt_eps * std::max(std::abs(x[i]), 1.0);
+                            const double x_plus = std::min(x[i] + h, upper[i]), x_minus = std::max(x[i] - h, lower[i]);
+
+                            double f_plus = f_x, f_minus = f_x;
+                            if (x_plus != x[i])
+                            {
+                                p[i]->set(x_plus);
+                                f_plus = sign * clone->evaluate();
+                                ++job_evaluations[j];
+                            }
+                            if (x_minus != x[i])
+                            {
+                                p[i]->set(x_minus);
+                                f_minus = sign * clone->evaluate();
+                                ++job_evaluations[j];
+                            }
+                            p[i]->set(x[i]);
+
+                            // parameters with an empty range do not contribute
+                            g[i] = (x_plus != x_minus) ? (f_plus - f_minus) / (x_plus - x_minus) : 0.0;
+                        }
+                    }
+                    catch (...)
+                    {
+                        exceptions[j] = std::current_exception();
+                    }
+                }));
+            }
+
+            for (auto & t : tickets)
+            {
+                t.wait();
+            }
+
+            for (auto & e : exceptions)
+            {
+                if (e)
+                    std::rethrow_exception(e);
+            }
+
+            for (const auto & e : job_evaluations)
+            {
+                evaluations += e;
+            }
+        }
+
+        // parameters at a bound are held fixed while the gradient points outside of the range
+        bool is_free(const unsigned & i, const std::vector<double> & x, const std::vector<double> & g) const
+        {
+            return ! (((x[i] <= lower[i]) && (g[i] > 0.0)) || ((x[i] >= upper[i]) && (g[i] < 0.0)));
+        }
+
+        double optimize(const double & sign)
+        {
+            static const double c1 = 1e-4;
+            static const unsigned max_backtracking_steps = 50;
+
+            const unsigned n = parameters.size();
+
+            iterations = 0;
+            evaluations = 0;
+            gradient_evaluations = 0;
+
+            // clones are created anew, so that they reflect all fixed parameters of the density
+            clones.clear();
+            clone_parameters.clear();
+
+            // start from the current point, projected onto the parameter ranges
+            std::vector<double> x(n), x_new(n), g, g_new, d(n), q(n);
+            for (unsigned i = 0 ; i < n ; ++i)
+            {
+                x[i] = std::min(std::max(parameters[i]->evaluate(), lower[i]), upper[i]);
+            }
+
+            double f = evaluate(x, sign);
+            if (! std::isfinite(f))
+                throw OptimizerError("OptimizerLBFGS: target function is not finite at the starting point");
+
+            gradient(x, f, sign, g);
+
+            // correction pairs, newest first
+            std::deque<std::vector<double>> s_history, y_history;
+            std::deque<double> rho_history;
+
+            while (true)
+            {
+                std::vector<bool> free_parameters(n);
+                double max_projected_gradient = 0.0;
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    free_parameters[i] = is_free(i, x, g);
+                    if (free_parameters[i])
+                        max_projected_gradient = std::max(max_projected_gradient, std::abs(g[i]));
+                }
+
+                if (max_projected_gradient <= tolerance)
+                    break;
+
+                if (iterations >= max_iterations)
+                    throw OptimizerError("OptimizerLBFGS did not converge after " + stringify(max_iterations) + " iterations!");
+
+                ++iterations;
+
+                // search direction from the two-loop recursion, restricted to the free parameters
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    q[i] = free_parameters[i] ? g[i] : 0.0;
+                }
+
+                std::vector<double> alpha(s_history.size());
+                for (unsigned k = 0 ; k < s_history.size() ; ++k)
+                {
+                    double s_q = 0.0;
+                    for (unsigned i = 0 ; i < n ; ++i)
+                        s_q += s_history[k][i] * q[i];
+
+                    alpha[k] = rho_history[k] * s_q;
+                    for (unsigned i = 0 ; i < n ; ++i)
+                        q[i] -= alpha[k] * y_history[k][i];
+                }
+
+                // initial inverse Hessian, scaled by the most recent curvature
+                double gamma = 1.0;
+                if (! s_history.empty())
+                {
+                    double y_y = 0.0;
+                    for (unsigned i = 0 ; i < n ; ++i)
+                        y_y += y_history[0][i] * y_history[0][i];
+
+                    gamma = 1.0 / (rho_history[0] * y_y);
+                }
+
+                for (unsigned i = 0 ; i < n ; ++i)
+                    q[i] *= gamma;
+
+                for (unsigned k = s_history.size() ; k-- > 0 ; )
+                {
+                    double y_q = 0.0;
+                    for (unsigned i = 0 ; i < n ; ++i)
+                        y_q += y_history[k][i] * q[i];
+
+                    const double beta = rho_history[k] * y_q;
+                    for (unsigned i = 0 ; i < n ; ++i)
+                        q[i] += (alpha[k] - beta) * s_history[k][i];
+                }
+
+                double slope = 0.0;
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    d[i] = free_parameters[i] ? -q[i] : 0.0;
+                    slope += d[i] * g[i];
+                }
+
+                // fall back to steepest descent if the quasi-Newton direction is not a descent direction
+                if ((slope >= 0.0) || (! std::isfinite(slope)))
+                {
+                    s_history.clear();
+                    y_history.clear();
+                    rho_history.clear();
+
+                    for (unsigned i = 0 ; i < n ; ++i)
+                        d[i] = free_parameters[i] ? -g[i] : 0.0;
+                }
+
+                // without curvature information, limit the first step to unit length along each parameter
+                double step_length = 1.0;
+                if (s_history.empty())
+                    step_length = std::min(1.0, 1.0 / max_projected_gradient);
+
+                // backtracking line search along the projected path
+                double f_new = f;
+                bool accepted = false, moved = true;
+                for (unsigned k = 0 ; (k < max_backtracking_steps) && moved ; ++k, step_length *= 0.5)
+                {
+                    double decrease = 0.0;
+                    moved = false;
+                    for (unsigned i = 0 ; i < n ; ++i)
+                    {
+                        x_new[i] = std::min(std::max(x[i] + step_length * d[i], lower[i]), upper[i]);
+                        decrease += g[i] * (x_new[i] - x[i]);
+                        moved |= (x_new[i] != x[i]);
+                    }
+
+                    if (! moved)
+                        break;
+
+                    f_new = evaluate(x_new, sign);
+                    if (std::isfinite(f_new) && (f_new <= f + c1 * decrease))
+                    {
+                        accepted = true;
+                        break;
+                    }
+                }
+
+                if (! accepted)
+                {
+                    // retry once along the steepest descent, otherwise the precision of the gradient is exhausted
+                    if (! s_history.empty())
+                    {
+                        s_history.clear();
+                        y_history.clear();
+                        rho_history.clear();
+
+                        continue;
+                    }
+
+                    throw OptimizerError("OptimizerLBFGS: line search failed with a largest projected gradient of "
+                            + stringify(max_projected_gradient) + " after " + stringify(iterations) + " iterations!");
+                }
+
+                gradient(x_new, f_new, sign, g_new);
+
+                // keep the correction pair only if it satisfies the curvature condition
+                std::vector<double> s(n), y(n);
+                double s_y = 0.0, y_y = 0.0;
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    s[i] = x_new[i] - x[i];
+                    y[i] = g_new[i] - g[i];
+                    s_y += s[i] * y[i];
+                    y_y += y[i] * y[i];
+                }
+
+                if (s_y > std::numeric_limits<double>::epsilon() * y_y)
+                {
+                    s_history.push_front(std::move(s));
+                    y_history.push_front(std::move(y));
+                    rho_history.push_front(1.0 / s_y);
+
+                    if (s_history.size() > history)
+                    {
+                        s_history.pop_back();
+                        y_history.pop_back();
+                        rho_history.pop_back();
+                    }
+                }
+
+                std::swap(x, x_new);
+                std::swap(g, g_new);
+                f = f_new;
+            }
+
+            density->set_point(x);
+
+            Log::instance()->message("OptimizerLBFGS::optimize", ll_informational)
+                << "Finished after " << iterations << " iterations, with " << evaluations << " evaluations of the density"
+                << " and " << gradient_evaluations << " evaluations of the gradient";
+
+            return sign * f;
+        }
+    };
+
+    OptimizerLBFGS::OptimizerLBFGS(const DensityPtr & density, const unsigned & max_iterations, const double & tolerance,
+            const unsigned & history, const Gradient & gradient) :
+        PrivateImplementationPattern<OptimizerLBFGS>(new Implementation<OptimizerLBFGS>(density, max_iterations, tolerance, history, gradient))
+    {
+    }
+
+    OptimizerLBFGS::~OptimizerLBFGS()
+    {
+    }
+
+    double
+    OptimizerLBFGS::maximize()
+    {
+        return _imp->optimize(-1.0);
+    }
+
+    double
+    OptimizerLBFGS::minimize()
+    {
+        return _imp->optimize(+1.0);
+    }
+
+    unsigned
+    OptimizerLBFGS::number_of_iterations() const
+    {
+        return _imp->iterations;
+    }
+
+    unsigned
+    OptimizerLBFGS::number_of_evaluations() const
+    {
+        return _imp->evaluations;
+    }
+
+    unsigned
+    OptimizerLBFGS::number_of_gradient_evaluations() const
+    {
+        return _imp->gradient_evaluations;
+    }
+}
@@ -0,0 +1,95 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_OPTIMIZE_OPTIMIZER_LBFGS_HH
+#define EOS_GUARD_EOS_OPTIMIZE_OPTIMIZER_LBFGS_HH 1
+
+#include <eos/optimize/optimizer.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <functional>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Limited-memory BFGS optimizer, bounded by the ranges of the density's parameters.
+     *
+     * Parameters at a bound are held fixed as long as the gradient points outside of
+     * the parameter range; all other parameters follow the quasi-Newton direction, and
+     * each trial point is projected back onto the parameter ranges.
+     *
+     * Unless an analytic gradient is provided, the gradient is computed from central
+     * finite differences. The 2n evaluations for n parameters are distributed across
+     * the ThreadPool, using one clone of the density per job.
+     *
+     * OptimizerError is thrown if the maximal number of iterations is exceeded, or if
+     * the line search fails to decrease the target function along the steepest descent.
+     */
+    class OptimizerLBFGS :
+        public Optimizer,
+        public PrivateImplementationPattern<OptimizerLBFGS>
+    {
+        public:
+            /*!
+             * Analytic gradient of the density on the log scale.
+             *
+             * @param point    The parameter point, in the order of iteration over the density's parameters.
+             * @param gradient The gradient at point, in the same order.
+             */
+            using Gradient = std::function<void (const std::vector<double> & point, std::vector<double> & gradient)>;
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param density        The density function to be optimized.
+             * @param max_iterations The maximal number of quasi-Newton iterations.
+             * @param tolerance      The optimization has converged once no component of the projected gradient
+             *                       exceeds the tolerance.
+             * @param history        The number of correction pairs used to approximate the inverse Hessian.
+             * @param gradient       The analytic gradient of the density. If empty, finite differences are used.
+             */
+            OptimizerLBFGS(const DensityPtr & density, const unsigned & max_iterations, const double & tolerance,
+                    const unsigned & history = 10, const Gradient & gradient = Gradient());
+
+            /// Destructor.
+            ~OptimizerLBFGS();
+            ///@}
+
+            virtual double maximize();
+
+            virtual double minimize();
+
+            ///@name Statistics of the last optimization
+            ///@{
+            /// The number of quasi-Newton iterations.
+            unsigned number_of_iterations() const;
+
+            /// The number of evaluations of the density or its clones, including those for finite differences.
+            unsigned number_of_evaluations() const;
+
+            /// The number of evaluations of the gradient.
+            unsigned number_of_gradient_evaluations() const;
+            ///@}
+    };
+}
+
+#endif
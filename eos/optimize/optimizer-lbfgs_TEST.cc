@@ -0,0 +1,166 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/optimize/optimizer.hh>
+#include <eos/optimize/optimizer-lbfgs.hh>
+#include <eos/statistics/density-wrapper.hh>
+#include <eos/statistics/simple-parameters.hh>
+#include <eos/utils/power_of.hh>
+#include <eos/utils/stringify.hh>
+#include <test/test.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    /*!
+     * A multivariate normal distribution with
+     * mean mu_i = i mod 5, and unit covariance on the log scale
+     */
+    double shifted_multivariate_unit_normal_pdf(const std::vector<double> parameters)
+    {
+        double result = 0;
+        unsigned i = 0;
+
+        for (const auto & p : parameters)
+        {
+            double mean = (i % 5) * 1.0 + 0.0;
+            result += -power_of<2>(p - mean) / 2.0;
+
+            ++i;
+        }
+
+        return result;
+    }
+
+    /*!
+     * The Rosenbrock function, with its minimum at (1, 1).
+     */
+    double rosenbrock(const std::vector<double> parameters)
+    {
+        return power_of<2>(1.0 - parameters[0]) + 100.0 * power_of<2>(parameters[1] - power_of<2>(parameters[0]));
+    }
+
+    DensityPtr
+    make_density(double (* f)(const std::vector<double>), const unsigned & ndim, const double & min, const double & max)
+    {
+        DensityWrapper * density = new DensityWrapper(DensityWrapper::WrappedDensity(f));
+
+        for (unsigned i = 0 ; i < ndim ; ++i)
+        {
+            density->add_parameter(std::string("par") + stringify(i), min, max);
+        }
+
+        return DensityPtr(density);
+    }
+}
+
+class OptimizerLBFGSTest :
+    public TestCase
+{
+    public:
+        OptimizerLBFGSTest() :
+            TestCase("optimizer_lbfgs_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // shifted_multivariate_unit_normal: 50D, from the origin
+            {
+                static const double eps = 1e-5;
+
+                DensityPtr density = make_density(&shifted_multivariate_unit_normal_pdf, 50, -5.0, 5.0);
+
+                OptimizerLBFGS optimizer(density, 100, 1e-7);
+                const double maximum = optimizer.maximize();
+                TEST_CHECK_NEARLY_EQUAL(0.0, maximum, 1e-9);
+
+                // the density is left at the location of the maximum
+                unsigned i = 0;
+                for (auto & p : *density)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(p.parameter->evaluate(), double(i++ % 5), eps);
+                }
+                TEST_CHECK_EQUAL(maximum, density->evaluate());
+
+                TEST_CHECK(optimizer.number_of_iterations() <= 10);
+                TEST_CHECK(optimizer.number_of_gradient_evaluations() >= optimizer.number_of_iterations());
+            }
+
+            // shifted_multivariate_unit_normal: 10D, optimum beyond the upper bound for some parameters
+            {
+                static const double eps = 1e-5;
+
+                DensityPtr density = make_density(&shifted_multivariate_unit_normal_pdf, 10, -5.0, 2.5);
+
+                OptimizerLBFGS optimizer(density, 100, 1e-7);
+                optimizer.maximize();
+
+                unsigned i = 0;
+                for (auto & p : *density)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(p.parameter->evaluate(), std::min(double(i++ % 5), 2.5), eps);
+                }
+            }
+
+            // rosenbrock: 2D, minimization with and without analytic gradient
+            {
+                static const double eps = 1e-5;
+
+                DensityPtr density = make_density(&rosenbrock, 2, -2.0, 2.0);
+                for (auto & p : *density)
+                {
+                    p.parameter->set(-1.2);
+                }
+
+                OptimizerLBFGS numerical(density, 500, 1e-8);
+                TEST_CHECK_NEARLY_EQUAL(0.0, numerical.minimize(), 1e-10);
+                for (auto & p : *density)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(1.0, p.parameter->evaluate(), eps);
+                }
+
+                for (auto & p : *density)
+                {
+                    p.parameter->set(-1.2);
+                }
+
+                auto gradient = [] (const std::vector<double> & x, std::vector<double> & g)
+                {
+                    g[0] = -2.0 * (1.0 - x[0]) - 400.0 * x[0] * (x[1] - x[0] * x[0]);
+                    g[1] = 200.0 * (x[1] - x[0] * x[0]);
+                };
+
+                OptimizerLBFGS analytic(density, 500, 1e-8, 10, gradient);
+                TEST_CHECK_NEARLY_EQUAL(0.0, analytic.minimize(), 1e-10);
+                for (auto & p : *density)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(1.0, p.parameter->evaluate(), eps);
+                }
+
+                // no finite differences with an analytic gradient
+                TEST_CHECK(analytic.number_of_evaluations() < numerical.number_of_evaluations());
+                TEST_CHECK(analytic.number_of_evaluations() <= analytic.number_of_iterations() * 50 + 1);
+            }
+        }
+} optimizer_lbfgs_test;
@@ -478,8 +478,63 @@ namespace eos
         return r + complex<double>(0.0, 1.0) * i;
     }
 
+    complex<double>
+    CharmLoopExpansion::operator() (const double & s) const
+    {
+        // F(s) diverges for s -> 0. However, s * F(s) -> 0 for s -> 0.
+        if (diverges_at_zero && (abs(s) < 1e-6)) // allow for s = 1e-6, corresponding roughly to the dielectron threshold
+            throw InternalError("CharmLoops::" + std::string(name) + "_massive: " + name + " diverges for s -> 0. Check that " + name
+                    + " enters via 's * " + name + "(s)' and replace by zero.");
+
+        double s_hat = s / m_b / m_b;
+
+        if (s_hat == 0)
+        {
+            return value_at_zero;
+        }
+
+        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
+        if ((0.0 < s_hat) && (s_hat <= 0.45))
+        {
+            log_s_hat.imag(0.0);
+        }
+        else if ((-0.45 <= s_hat) && (s_hat <= -0.00))
+        {
+            log_s_hat.imag(+M_PI);
+        }
+        else
+        {
+            throw InternalError("CharmLoop::" + std::string(name) + "_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
+        }
+
+        complex<double> result = a[3] + b[3] * log_s_hat;
+        for (int k = 2 ; k >= 0 ; --k)
+            result = result * s_hat + a[k] + b[k] * log_s_hat;
+
+        return result;
+    }
+
     namespace impl
     {
+        CharmLoopExpansion expansion(const char * name, const double & m_b,
+                const double (&ra)[4], const double (&ia)[4], const double (&rb)[4], const double (&ib)[4],
+                bool diverges_at_zero, const complex<double> & value_at_zero)
+        {
+            CharmLoopExpansion result;
+            result.name = name;
+            result.m_b = m_b;
+            result.diverges_at_zero = diverges_at_zero;
+            result.value_at_zero = value_at_zero;
+
+            for (int k = 0 ; k < 4 ; k++)
+            {
+                result.a[k] = complex<double>(ra[k], ia[k]);
+                result.b[k] = complex<double>(rb[k], ib[k]);
+            }
+
+            return result;
+        }
+
         complex<double> f27_0(const double & mu, const double & m_b, const double & m_q)
         {
             static long double kap2700[7][5][2] = {
@@ -519,6 +574,13 @@ namespace eos
     // cf. [AAGW2001], Eq. (56), p. 20
     complex<double>
     CharmLoops::F27_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    {
+        return F27_massive_expansion(mu, m_b, m_q)(s);
+    }
+
+    // cf. [AAGW2001], Eq. (56), p. 20
+    CharmLoopExpansion
+    CharmLoops::F27_massive_expansion(const double & mu, const double & m_b, const double & m_q)
     {
         // cf. [ABGW2001], Appendix B, pp. 34-38
         static double kap2700[7][5][2] = {
@@ -592,107 +654,90 @@ namespace eos
         };
 
         double m_q_hat = m_q / m_b, z = pow(m_q_hat, 2);
-        double s_hat = s / m_b / m_b;
 
         const double rho27[4] = {
             -11.6973 * pow(m_q_hat, 3), -70.1839 * m_q_hat, -421.103 * m_q_hat, 23.3946 / m_q_hat - 959.179 * m_q_hat
         };
 
-        if (s_hat == 0)
-        {
-            return impl::f27_0(mu, m_b, m_q);
-        }
-
-        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
-        if ((0.0 < s_hat) && (s_hat <= 0.45))
-        {
-            log_s_hat.imag(0.0);
-        }
-        else if ((-0.45 <= s_hat) && (s_hat <= -0.00))
-        {
-            log_s_hat.imag(+M_PI);
-        }
-        else
-        {
-            throw InternalError("CharmLoop::F27_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
-        }
+        // coefficients of s_hat^k (a) and s_hat^k log(s_hat) (b), split into real (r) and imaginary (i) parts
+        double ra[4] = { 416.0 / 81.0 * log(mu / m_b), 0.0, 0.0, 0.0 }, ia[4] = { 0.0, 0.0, 0.0, 0.0 };
+        double rb[4] = { 0.0, 0.0, 0.0, 0.0 },                           ib[4] = { 0.0, 0.0, 0.0, 0.0 };
 
         // real part
-        complex<double> r = 416.0 / 81.0 * log(mu / m_b);
-
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 4 ; m++)
-                r = r + kap2700[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+                ra[0] += kap2700[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2710[l][m][0] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ra[1] += kap2710[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2711[l][m][0] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                rb[1] += kap2711[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 2 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2720[l][m][0] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ra[2] += kap2720[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2721[l][m][0] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                rb[2] += kap2721[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2730[l][m][0] * pow(s_hat, 3) * pow(z, l-3) * pow(log(m_q_hat), m);
+                ra[3] += kap2730[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2731[l][m][0] * pow(s_hat, 3) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                rb[3] += kap2731[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 0 ; l < 4; l++)
-            r = r + rho27[l] * pow(s_hat, l);
+            ra[l] += rho27[l];
 
         // imaginary part
-        complex<double> i = 0.0;
-
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2700[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[0] += kap2700[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2710[l][m][1] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[1] += kap2710[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2711[l][m][1] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ib[1] += kap2711[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2720[l][m][1] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[2] += kap2720[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2721[l][m][1] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ib[2] += kap2721[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2730[l][m][1] * pow(s_hat, 3) * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[3] += kap2730[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2731[l][m][1] * pow(s_hat, 3) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ib[3] += kap2731[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        return r + complex<double>(0.0, 1.0) * i;
+        return impl::expansion("F27", m_b, ra, ia, rb, ib, false, impl::f27_0(mu, m_b, m_q));
     }
 
     // cf. [AAGW2001], Eq. (54), p. 19
     complex<double>
     CharmLoops::F19_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
     {
-        // F19(s) diverges for s -> 0. However, s * F19(s) -> 0 for s -> 0.
-        if (abs(s) < 1e-6) // allow for s = 1e-6, corresponding roughly to the dielectron threshold
-            throw InternalError("CharmLoops::F19_massive: F19 diverges for s -> 0. Check that F19 enters via 's * F19(s)' and replace by zero.");
+        return F19_massive_expansion(mu, m_b, m_q)(s);
+    }
 
+    // cf. [AAGW2001], Eq. (54), p. 19
+    CharmLoopExpansion
+    CharmLoops::F19_massive_expansion(const double & mu, const double & m_b, const double & m_q)
+    {
         // cf. [ABGW2001], Appendix B, pp. 34-38
         static double kap1900[7][5][2] = {
             {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
@@ -775,115 +820,105 @@ namespace eos
         };
 
         double m_q_hat = m_q / m_b, z = pow(m_q_hat, 2);
-        double s_hat = s / m_b / m_b;
-
-        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
-        if ((0.000 <= s_hat) && (s_hat <= 0.45))
-        {
-            log_s_hat.imag(0.0);
-        }
-        else if ((-0.45 <= s_hat) && (s_hat <= -0.000))
-        {
-            log_s_hat.imag(+M_PI);
-        }
-        else
-        {
-            throw InternalError("CharmLoop::F19_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
-        }
 
         const double rho19[4] = {
             3.8991 * pow(m_q_hat, 3), -23.3946 * m_q_hat, -140.368 * m_q_hat, 7.79821 / m_q_hat - 319.726 * m_q_hat
         };
 
+        // coefficients of s_hat^k (a) and s_hat^k log(s_hat) (b), split into real (r) and imaginary (i) parts
+        double ra[4] = {
+            (-1424.0 / 729.0 + 64.0 / 27.0 * log(m_q_hat)) * log(mu/m_b) - 256.0 / 243.0 * pow(log(mu/m_b), 2),
+            (16.0 / 1215.0 - 32.0 / 135.0 /pow(m_q_hat, 2)) * log(mu/m_b),
+            (4.0 / 2835.0 - 8.0 / 315.0 /pow(m_q_hat, 4)) * log(mu/m_b),
+            (16.0 / 76545.0 - 32.0 /8505.0 / pow(m_q_hat, 6)) * log(mu/m_b)
+        };
+        double ia[4] = { 16.0 / 243.0 * M_PI * log(mu/m_b), 0.0, 0.0, 0.0 };
+        double rb[4] = { -16.0 / 243.0 * log(mu/m_b), 0.0, 0.0, 0.0 };
+        double ib[4] = { 0.0, 0.0, 0.0, 0.0 };
+
         // real part
-        complex<double> r = (-1424.0 / 729.0 + 64.0 / 27.0 * log(m_q_hat)) * log(mu/m_b)
-            - 16.0 / 243.0 * log(mu/m_b) * log_s_hat
-            + (16.0 / 1215.0 - 32.0 / 135.0 /pow(m_q_hat, 2)) * log(mu/m_b) * s_hat
-            + (4.0 / 2835.0 - 8.0 / 315.0 /pow(m_q_hat, 4)) * log(mu/m_b) * s_hat * s_hat
-            + (16.0 / 76545.0 - 32.0 /8505.0 / pow(m_q_hat, 6)) * log(mu/m_b) * pow(s_hat, 3)
-            - 256.0 / 243.0 * pow(log(mu/m_b), 2);
-
-        for (int l = 3  ; l < 7 ; l++)
-            for (int m = 0  ; m < 4  ; m++)
-                r = r + kap1900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
-
-        for (int l = 3  ; l < 7 ; l++)
+        for (int l = 3 ; l < 7 ; l++)
+            for (int m = 0 ; m < 4 ; m++)
+                ra[0] += kap1900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+        for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1901[l][m][0] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                rb[0] += kap1901[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 2  ; l < 7 ; l++)
+        for (int l = 2 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1910[l][m][0] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ra[1] += kap1910[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 4  ; l < 7 ; l++)
+        for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1911[l][m][0] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                rb[1] += kap1911[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 1  ; l < 7 ; l++)
+        for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1920[l][m][0] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ra[2] += kap1920[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 3  ; l < 7 ; l++)
+        for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1921[l][m][0] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                rb[2] += kap1921[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 0  ; l < 7 ; l++)
+        for (int l = 0 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1930[l][m][0] * pow(s_hat, 3) * pow(z, l-3) * pow(log(m_q_hat), m);
+                ra[3] += kap1930[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 3  ; l < 7 ; l++)
+        for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1931[l][m][0] * pow(s_hat, 3) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                rb[3] += kap1931[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 0  ; l < 4; l++)
-            r = r + rho19[l] * pow(s_hat, l);
+        for (int l = 0 ; l < 4; l++)
+            ra[l] += rho19[l];
 
         // imaginary part
-        complex<double> i = 16.0 / 243.0 * M_PI * log(mu/m_b);
-
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[0] += kap1900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1901[l][m][1] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ib[0] += kap1901[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 2 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1910[l][m][1] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[1] += kap1910[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1911[l][m][1] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ib[1] += kap1911[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1920[l][m][1] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[2] += kap1920[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1921[l][m][1] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ib[2] += kap1921[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 0 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1930[l][m][1] * pow(s_hat, 3) * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[3] += kap1930[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1931[l][m][1] * pow(s_hat, 3) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ib[3] += kap1931[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        return r + complex<double>(0.0, 1.0) * i;
+        return impl::expansion("F19", m_b, ra, ia, rb, ib, true, 0.0);
     }
 
     // cf. [AAGW2001], Eq. (54), p. 19
     complex<double>
     CharmLoops::F29_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
     {
-        // F29(s) diverges for s -> 0. However, s * F29(s) -> 0 for s -> 0.
-        if (abs(s) < 1e-6) // allow for s = 1e-6, corresponding roughly to the dielectron threshold
-            throw InternalError("CharmLoops::F29_massive: F29 diverges for s -> 0. Check that F29 enters via 's * F29(s)' and replace by zero.");
+        return F29_massive_expansion(mu, m_b, m_q)(s);
+    }
 
+    // cf. [AAGW2001], Eq. (54), p. 19
+    CharmLoopExpansion
+    CharmLoops::F29_massive_expansion(const double & mu, const double & m_b, const double & m_q)
+    {
         // cf. [ABGW2001], Appendix B, pp. 34-38
         static double kap2900[7][5][2] = {
             {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
@@ -965,105 +1000,92 @@ namespace eos
         };
 
         double m_q_hat = m_q / m_b, z = pow(m_q_hat, 2);
-        double s_hat = s / m_b / m_b;
-
-        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
-        if ((0.000 <= s_hat) && (s_hat <= 0.45))
-        {
-            log_s_hat.imag(0.0);
-        }
-        else if ((-0.45 <= s_hat) && (s_hat <= -0.000))
-        {
-            log_s_hat.imag(+M_PI);
-        }
-        else
-        {
-            throw InternalError("CharmLoop::F29_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
-        }
 
         const double rho29[4] = {
             -23.3946 * pow(m_q_hat, 3), 140.368 * m_q_hat, 842.206 * m_q_hat, -46.7892 / m_q_hat + 1918.36 * m_q_hat
         };
 
-        // real part
-        complex<double> r = (256.0 / 243.0 - 128.0 / 9.0 * log(m_q_hat)) * log(mu / m_b)
-            + 32.0 / 81.0 * log(mu / m_b) * log_s_hat
-            + (-32.0 / 405.0 + 64.0 / 45 / pow(m_q_hat, 2)) * log(mu / m_b) * s_hat
-            + (-8.0 / 945.0 + 16.0 / 105 / pow(m_q_hat, 4)) * log(mu / m_b) * s_hat * s_hat
-            + (-32.0 / 25515.0 + 64.0 / 2835 / pow(m_q_hat, 6)) * log(mu / m_b) * pow(s_hat, 3)
-            + 512.0 / 81.0 * pow(log(mu / m_b), 2);
+        // coefficients of s_hat^k (a) and s_hat^k log(s_hat) (b), split into real (r) and imaginary (i) parts
+        double ra[4] = {
+            (256.0 / 243.0 - 128.0 / 9.0 * log(m_q_hat)) * log(mu / m_b) + 512.0 / 81.0 * pow(log(mu / m_b), 2),
+            (-32.0 / 405.0 + 64.0 / 45 / pow(m_q_hat, 2)) * log(mu / m_b),
+            (-8.0 / 945.0 + 16.0 / 105 / pow(m_q_hat, 4)) * log(mu / m_b),
+            (-32.0 / 25515.0 + 64.0 / 2835 / pow(m_q_hat, 6)) * log(mu / m_b)
+        };
+        double ia[4] = { - 32.0 / 81.0 * M_PI * log(mu/m_b), 0.0, 0.0, 0.0 };
+        double rb[4] = { 32.0 / 81.0 * log(mu / m_b), 0.0, 0.0, 0.0 };
+        double ib[4] = { 0.0, 0.0, 0.0, 0.0 };
 
+        // real part
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 4 ; m++)
-                r = r + kap2900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+                ra[0] += kap2900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2901[l][m][0] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                rb[0] += kap2901[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 2 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2910[l][m][0] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ra[1] += kap2910[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2911[l][m][0] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                rb[1] += kap2911[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2920[l][m][0] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ra[2] += kap2920[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2921[l][m][0] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                rb[2] += kap2921[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 0 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2930[l][m][0] * pow(s_hat, 3) * pow(z, l-3) * pow(log(m_q_hat), m);
+                ra[3] += kap2930[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2931[l][m][0] * pow(s_hat, 3) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                rb[3] += kap2931[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 0 ; l < 4; l++)
-            r = r + rho29[l] * pow(s_hat, l);
+            ra[l] += rho29[l];
 
         // imaginary part
-        complex<double> i = - 32.0 / 81.0 * M_PI * log(mu/m_b);
-
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[0] += kap2900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2901[l][m][1] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ib[0] += kap2901[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 2 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2910[l][m][1] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[1] += kap2910[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2911[l][m][1] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ib[1] += kap2911[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2920[l][m][1] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[2] += kap2920[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2921[l][m][1] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ib[2] += kap2921[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 0 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2930[l][m][1] * pow(s_hat, 3) * pow(z, l-3) * pow(log(m_q_hat), m);
+                ia[3] += kap2930[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2931[l][m][1] * pow(s_hat, 3) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                ib[3] += kap2931[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        return r + complex<double>(0.0, 1.0) * i;
+        return impl::expansion("F29", m_b, ra, ia, rb, ib, true, 0.0);
     }
 
     // cf. [AAGW2001], eqs. (48) and (49), p. 18
@@ -23,8 +23,45 @@
 #include <eos/utils/complex.hh>
 #include <eos/utils/model.hh>
 
+#include <array>
+
 namespace eos
 {
+    /*!
+     * Dependence of a massive two-loop function on the dilepton invariant mass s,
+     * at fixed renormalization scale and quark masses.
+     *
+     * The expansions of [ABGW2001] are exactly of the form
+     *
+     *   F(s) = sum_{k=0}^{3} s_hat^k (a_k + b_k log(s_hat)),   s_hat = s / m_b^2,
+     *
+     * within their domain of validity |s_hat| <= 0.45. The coefficients depend only on
+     * (mu, m_b, m_c), and can therefore be computed once and reused for all values of s.
+     */
+    struct CharmLoopExpansion
+    {
+        /// Name of the function, for error messages.
+        const char * name = "";
+
+        /// Mass of the bottom quark.
+        double m_b = 1.0;
+
+        /// Coefficients of s_hat^k.
+        std::array<complex<double>, 4> a;
+
+        /// Coefficients of s_hat^k log(s_hat).
+        std::array<complex<double>, 4> b;
+
+        /// True if the function diverges for s -> 0, due to a non-vanishing b_0.
+        bool diverges_at_zero = false;
+
+        /// Value of the function at s = 0, if it does not diverge.
+        complex<double> value_at_zero;
+
+        /// Evaluate the function at s.
+        complex<double> operator() (const double & s) const;
+    };
+
     struct CharmLoops
     {
         /* One-loop functions */
@@ -56,6 +93,10 @@ namespace eos
         static complex<double> F19_massive(const double & mu, const double & s, const double & m_b, const double & m_c);
         static complex<double> F27_massive(const double & mu, const double & s, const double & m_b, const double & m_c);
         static complex<double> F29_massive(const double & mu, const double & s, const double & m_b, const double & m_c);
+        // s-independent coefficients of the massive case, for repeated evaluation at fixed (mu, m_b, m_c)
+        static CharmLoopExpansion F19_massive_expansion(const double & mu, const double & m_b, const double & m_c);
+        static CharmLoopExpansion F27_massive_expansion(const double & mu, const double & m_b, const double & m_c);
+        static CharmLoopExpansion F29_massive_expansion(const double & mu, const double & m_b, const double & m_c);
         static complex<double> delta_F29_massive(const double & mu, const double & s, const double & m_c);
 
         // helper functions for F8j, cf. [BFS2001], Eqs. (29) and (84), pp. 8 and 30
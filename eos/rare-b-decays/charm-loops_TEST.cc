@@ -417,6 +417,36 @@ class FormFactorsTest :
                 TEST_CHECK_RELATIVE_ERROR(+ 4.0282600,  real(CharmLoops::F29_massive(mu, -1.0, m_b, m_c)), eps);
                 TEST_CHECK_RELATIVE_ERROR(- 0.6601020,  imag(CharmLoops::F29_massive(mu, -1.0, m_b, m_c)), eps);
             }
+
+            /* Formfactors, massive loops evaluated from one expansion at several s/q^2 */
+            {
+                static const double mu = 4.2, m_b = 4.6, m_c = 1.2, eps = 1e-5;
+
+                const CharmLoopExpansion F19 = CharmLoops::F19_massive_expansion(mu, m_b, m_c);
+                const CharmLoopExpansion F27 = CharmLoops::F27_massive_expansion(mu, m_b, m_c);
+                const CharmLoopExpansion F29 = CharmLoops::F29_massive_expansion(mu, m_b, m_c);
+
+                TEST_CHECK_RELATIVE_ERROR(+ 4.38563254, real(F27(+6.0)), eps);
+                TEST_CHECK_RELATIVE_ERROR(+ 1.06627403, imag(F27(+6.0)), eps);
+                TEST_CHECK_RELATIVE_ERROR(+ 3.5112500,  real(F27(-6.0)), eps);
+                TEST_CHECK_RELATIVE_ERROR(+ 0.3736050,  imag(F27(-6.0)), eps);
+                TEST_CHECK_RELATIVE_ERROR(-34.40870331, real(F19(+6.0)), eps);
+                TEST_CHECK_RELATIVE_ERROR(- 0.25864665, imag(F19(+6.0)), eps);
+                TEST_CHECK_RELATIVE_ERROR(-10.1066000,  real(F19(-1.0)), eps);
+                TEST_CHECK_RELATIVE_ERROR(+ 0.1100320,  imag(F19(-1.0)), eps);
+                TEST_CHECK_RELATIVE_ERROR(+ 6.27364439, real(F29(+6.0)), eps);
+                TEST_CHECK_RELATIVE_ERROR(+ 1.55195807, imag(F29(+6.0)), eps);
+                TEST_CHECK_RELATIVE_ERROR(+ 4.4729700,  real(F29(-6.0)), eps);
+                TEST_CHECK_RELATIVE_ERROR(- 0.7247960,  imag(F29(-6.0)), eps);
+
+                // F27 is finite at s = 0, F19 and F29 diverge
+                TEST_CHECK_EQUAL(CharmLoops::F27_massive(mu, 0.0, m_b, m_c), F27(0.0));
+                TEST_CHECK_THROWS(InternalError, F19(0.0));
+                TEST_CHECK_THROWS(InternalError, F29(0.0));
+
+                // outside the domain of validity
+                TEST_CHECK_THROWS(InternalError, F27(0.5 * m_b * m_b));
+            }
         }
 } two_loop_test;
 
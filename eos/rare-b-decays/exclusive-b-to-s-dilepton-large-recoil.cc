@@ -40,6 +40,7 @@
 
 #include <cmath>
 #include <functional>
+#include <tuple>
 
 #include <gsl/gsl_sf.h>
 
@@ -120,6 +121,10 @@ namespace eos
 
         std::shared_ptr<FormFactors<PToV>> form_factors;
 
+        using IntermediateResult = BToKstarDilepton<LargeRecoil>::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make(o.get("model", "WilsonScan"), p, o)),
             parameters(p),
@@ -308,10 +313,10 @@ namespace eos
             complex<double> C1f_top_perp_right = (c7eff + wc.c7prime()) * (8.0 * std::log(m_b_PS / mu()) - L - 4.0 * (1.0 - mu_f() / m_b_PS));
             // cf. [BFS2001], Eqs. (34), (37), p. 9
             complex<double> C1nf_top_perp = (-1.0 / QCD::casimir_f) * (
-                    (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
+                    (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive_expansion, mu(), m_b_PS, m_c_pole)(s) + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
                     + (s / (2.0 * m_b_PS * m_B)) * (
-                        wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
-                        + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
+                        wc.c1() * memoise(CharmLoops::F19_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
+                        + wc.c2() * memoise(CharmLoops::F29_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
                         + c8eff * CharmLoops::F89_massless(s, m_b_PS)));
 
             /* perpendicular, up sector */
@@ -321,10 +326,10 @@ namespace eos
             // cf. [BFS2001], Eqs. (34), (37), p. 9
             // [BFS2004], [S2004] have a different sign convention for F{12}{79}_massless than we!
             complex<double> C1nf_up_perp = (-1.0 / QCD::casimir_f) * (
-                    (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                    (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F27_massless(mu, s, m_b_PS))
                     + (s / (2.0 * m_b_PS * m_B)) * (
-                        wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                        + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                        wc.c1() * (memoise(CharmLoops::F19_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F19_massless(mu, s, m_b_PS))
+                        + wc.c2() * (memoise(CharmLoops::F29_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F29_massless(mu, s, m_b_PS))));
 
             /* parallel, top sector */
             // cf. [BFS2001], Eqs. (14), (15), p. 5, in comparison with \delta_{2,3} = 1
@@ -333,11 +338,11 @@ namespace eos
             complex<double> C1f_top_par = -1.0 * (c7eff - wc.c7prime()) * (8.0 * std::log(m_b_PS / mu) + 2.0 * L - 4.0 * (1.0 - mu_f() / m_b_PS));
             // cf. [BFS2001], Eqs. (38), p. 9
             complex<double> C1nf_top_par = (+1.0 / QCD::casimir_f) * (
-                    (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole)
+                    (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
                     + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
                     + (m_B / (2.0 * m_b_PS)) * (
-                        wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
-                        + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
+                        wc.c1() * memoise(CharmLoops::F19_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
+                        + wc.c2() * memoise(CharmLoops::F29_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
                         + c8eff * CharmLoops::F89_massless(s, m_b_PS)));
 
             /* parallel, up sector */
@@ -347,10 +352,10 @@ namespace eos
             // cf. [BFS2004], last paragraph in Sec A.1, p. 24
             // [BFS2004], [S2004] have a different sign convention for F{12}{79}_massless than we!
             complex<double> C1nf_up_par = (+1.0 / QCD::casimir_f) * (
-                    (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                    (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F27_massless(mu, s, m_b_PS))
                     + (m_B / (2.0 * m_b_PS)) * (
-                        wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                        + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                        wc.c1() * (memoise(CharmLoops::F19_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F19_massless(mu, s, m_b_PS))
+                        + wc.c2() * (memoise(CharmLoops::F29_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F29_massless(mu, s, m_b_PS))));
 
             // compute the factorizing contributions
             complex<double> C_perp_left  = C0_top_perp_left  + lambda_hat_u * C0_up_perp
@@ -513,40 +518,40 @@ namespace eos
             // cf. [BFS2001], Eqs. (34), (37), p. 9
             const complex<double>
                 C1nf_top_perp = (-1.0 / QCD::casimir_f) * (
-                    (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole)
+                    (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
                     + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
                     + (s / (2.0 * m_b_PS * m_B)) * (
-                        wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
-                        + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
+                        wc.c1() * memoise(CharmLoops::F19_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
+                        + wc.c2() * memoise(CharmLoops::F29_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
                         + c8eff * CharmLoops::F89_massless(s, m_b_PS))),
 
             /* perpendicular, up sector */
             // cf. [BFS2001], Eqs. (34), (37), p. 9
             // [BFS2004], [S2004] have a different sign convention for F{12}{79}_massless than we!
                 C1nf_up_perp = (-1.0 / QCD::casimir_f) * (
-                    (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                    (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F27_massless(mu, s, m_b_PS))
                     + (s / (2.0 * m_b_PS * m_B)) * (
-                        wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                        + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS)))),
+                        wc.c1() * (memoise(CharmLoops::F19_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F19_massless(mu, s, m_b_PS))
+                        + wc.c2() * (memoise(CharmLoops::F29_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F29_massless(mu, s, m_b_PS)))),
 
             /* parallel, top sector */
             // cf. [BFS2001], Eqs. (38), p. 9
                 C1nf_top_par = (+1.0 / QCD::casimir_f) * (
-                    (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole)
+                    (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
                     + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
                     + (m_B / (2.0 * m_b_PS)) * (
-                        wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
-                        + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
+                        wc.c1() * memoise(CharmLoops::F19_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
+                        + wc.c2() * memoise(CharmLoops::F29_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
                         + c8eff * CharmLoops::F89_massless(s, m_b_PS))),
 
             /* parallel, up sector */
             // cf. [BFS2004], last paragraph in Sec A.1, p. 24
             // [BFS2004], [S2004] have a different sign convention for F{12}{79}_massless than we!
                 C1nf_up_par = (+1.0 / QCD::casimir_f) * (
-                    (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                    (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F27_massless(mu, s, m_b_PS))
                     + (m_B / (2.0 * m_b_PS)) * (
-                        wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                        + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                        wc.c1() * (memoise(CharmLoops::F19_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F19_massless(mu, s, m_b_PS))
+                        + wc.c2() * (memoise(CharmLoops::F29_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F29_massless(mu, s, m_b_PS))));
 
             // compute the factorizing contributions
             // in ABBBSW2008: C0 is included in naively factorizing part and C1f = 0
@@ -988,13 +993,42 @@ namespace eos
             return array_to_angular_coefficients(angular_coefficients_array(amplitudes(s), s, m_l()));
         }
 
-        AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
+        std::array<double, 12> integrated_angular_coefficients_array(const double & s_min, const double & s_max) const
         {
             std::function<std::array<double, 12> (const double &)> integrand =
                     std::bind(&Implementation<BToKstarDilepton<LargeRecoil>>::differential_angular_coefficients_array, this, std::placeholders::_1);
-            std::array<double, 12> integrated_angular_coefficients_array = integrate1D(integrand, 64, s_min, s_max);
 
-            return array_to_angular_coefficients(integrated_angular_coefficients_array);
+            return integrate1D(integrand, 64, s_min, s_max);
+        }
+
+        AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
+        {
+            return array_to_angular_coefficients(integrated_angular_coefficients_array(s_min, s_max));
+        }
+
+        // integrates both CP modes, such that the evaluation of the cached observables does not change any state
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
+        {
+            intermediate_result.s_min = s_min;
+            intermediate_result.s_max = s_max;
+            intermediate_result.j = integrated_angular_coefficients_array(s_min, s_max);
+
+            {
+                Save<bool> save(cp_conjugate, ! cp_conjugate);
+
+                intermediate_result.j_bar = integrated_angular_coefficients_array(s_min, s_max);
+            }
+
+            return &intermediate_result;
+        }
+
+        // returns the integrated angular coefficients of the decay and of its CP conjugate, in this order
+        std::pair<AngularCoefficients, AngularCoefficients> cp_angular_coefficients(const IntermediateResult * ir) const
+        {
+            AngularCoefficients a_c     = array_to_angular_coefficients(ir->j);
+            AngularCoefficients a_c_bar = array_to_angular_coefficients(ir->j_bar);
+
+            return cp_conjugate ? std::make_pair(a_c_bar, a_c) : std::make_pair(a_c, a_c_bar);
         }
 
         double a_fb_zero_crossing() const
@@ -1582,31 +1616,19 @@ namespace eos
     double
     BToKstarDilepton<LargeRecoil>::integrated_branching_ratio(const double & s_min, const double & s_max) const
     {
-        return integrated_decay_width(s_min, s_max) * _imp->tau() / _imp->hbar();
+        return integrated_branching_ratio(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_branching_ratio_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        double br = integrated_branching_ratio(s_min, s_max);
-        _imp->cp_conjugate = true;
-        double br_bar = integrated_branching_ratio(s_min, s_max);
-
-        return 0.5 * (br + br_bar);
+        return integrated_branching_ratio_cp_averaged(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_cp_asymmetry(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        double gamma = integrated_decay_width(s_min, s_max);
-        _imp->cp_conjugate = true;
-        double gamma_bar = integrated_decay_width(s_min, s_max);
-
-        return (gamma - gamma_bar) / (gamma + gamma_bar);
+        return integrated_cp_asymmetry(prepare(s_min, s_max));
     }
 
     double
@@ -1626,204 +1648,127 @@ namespace eos
     double
     BToKstarDilepton<LargeRecoil>::integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const
     {
-        // cf. [BHvD2010], eq. (2.8), p. 6
-        // cf. [BHvD2012], eq. (A7)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return (a_c.j6s + 0.5 * a_c.j6c) / decay_width(a_c);
+        return integrated_forward_backward_asymmetry(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_forward_backward_asymmetry_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        double a_fb = integrated_forward_backward_asymmetry(s_min, s_max);
-        _imp->cp_conjugate = true;
-        double a_fb_bar = integrated_forward_backward_asymmetry(s_min, s_max);
-
-        return 0.5 * (a_fb + a_fb_bar);
+        return integrated_forward_backward_asymmetry_cp_averaged(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_longitudinal_polarisation(const double & s_min, const double & s_max) const
     {
-        // cf. [BHvD2012], eq. (A9)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return (a_c.j1c - a_c.j2c / 3.0) / decay_width(a_c);
+        return integrated_longitudinal_polarisation(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_longitudinal_polarisation_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        double f_l = integrated_longitudinal_polarisation(s_min, s_max);
-        _imp->cp_conjugate = true;
-        double f_l_bar = integrated_longitudinal_polarisation(s_min, s_max);
-
-        return 0.5 * (f_l + f_l_bar);
+        return integrated_longitudinal_polarisation_cp_averaged(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_transversal_polarisation(const double & s_min, const double & s_max) const
     {
-        // cf. [BHvD2012], eq. (A10)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return 2.0 * (a_c.j1s - a_c.j2s / 3.0) / decay_width(a_c);
+        return integrated_transversal_polarisation(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_transversal_polarisation_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        double f_t = integrated_transversal_polarisation(s_min, s_max);
-        _imp->cp_conjugate = true;
-        double f_t_bar = integrated_transversal_polarisation(s_min, s_max);
-
-        return 0.5 * (f_t + f_t_bar);
+        return integrated_transversal_polarisation_cp_averaged(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_2(const double & s_min, const double & s_max) const
     {
-        // cf. [BHvD2010], eq. (2.10), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return 0.5 * a_c.j3 / a_c.j2s;
+        return integrated_transverse_asymmetry_2(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_2_cp_averaged(const double & s_min, const double & s_max) const
     {
-        // cf. [BHvD2010], eq. (2.10), p. 6
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        double a_t_2 = integrated_transverse_asymmetry_2(s_min, s_max);
-        _imp->cp_conjugate = true;
-        double a_t_2_bar = integrated_transverse_asymmetry_2(s_min, s_max);
-
-        return 0.5 * (a_t_2 + a_t_2_bar);
+        return integrated_transverse_asymmetry_2_cp_averaged(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_3(const double & s_min, const double & s_max) const
     {
-        // cf. [BHvD2010], eq. (2.11), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        return sqrt((4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)) / (-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3)));
+        return integrated_transverse_asymmetry_3(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_4(const double & s_min, const double & s_max) const
     {
-        // cf. [BHvD2010], eq. (2.12), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        return sqrt((power_of<2>(a_c.j5) + 4.0 * power_of<2>(a_c.j8)) / (4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)));
+        return integrated_transverse_asymmetry_4(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_5(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        // cf. [BS2011], eq. (34), p. 9 for the massless case
-        return std::sqrt(16.0 * power_of<2>(a_c.j2s) - power_of<2>(a_c.j6s) - 4.0 * (power_of<2>(a_c.j3) + power_of<2>(a_c.j9)))
-            / 8.0 / a_c.j2s;
+        return integrated_transverse_asymmetry_5(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_re(const double & s_min, const double & s_max) const
     {
-        // cf. [BS2011], eq. (38), p. 10
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return 0.25 * a_c.j6s / a_c.j2s;
+        return integrated_transverse_asymmetry_re(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_im(const double & s_min, const double & s_max) const
     {
-        // cf. [BS2011], eq. (30), p. 8
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return 0.5 * a_c.j9 / a_c.j2s;
+        return integrated_transverse_asymmetry_im(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_p_prime_4(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        // cf. [DMRV2012], p. 9, eq. (15)
-        return (a_c.j4 + a_c_bar.j4) / std::sqrt(-1.0 * (a_c.j2c + a_c_bar.j2c) * (a_c.j2s + a_c_bar.j2s));
+        return integrated_p_prime_4(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_p_prime_5(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        // cf. [DMRV2012], p. 9, eq. (16)
-        return (a_c.j5 + a_c_bar.j5) / (2.0 * std::sqrt(-1.0 * (a_c.j2c + a_c_bar.j2c) * (a_c.j2s + a_c_bar.j2s)));
+        return integrated_p_prime_5(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_p_prime_6(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        // cf. [DMRV2012], p. 9, eq. (17)
-        return -1.0 * (a_c.j7 + a_c_bar.j7) / (2.0 * std::sqrt(-1.0 * (a_c.j2c + a_c_bar.j2c) * (a_c.j2s + a_c_bar.j2s)));
+        return integrated_p_prime_6(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_h_1(const double & s_min, const double & s_max) const
     {
-        // cf. [BHvD2010], p. 7, eq. (2.13)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return sqrt(2.0) * a_c.j4 / sqrt(-a_c.j2c * (2.0 * a_c.j2s - a_c.j3));
+        return integrated_h_1(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_h_2(const double & s_min, const double & s_max) const
     {
-        // cf. [BHvD2010], p. 7, eq. (2.14)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return  a_c.j5 / sqrt(-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
+        return integrated_h_2(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_h_3(const double & s_min, const double & s_max) const
     {
-        // cf. [BHvD2010], p. 7, eq. (2.15)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j6s / (2.0 * sqrt(power_of<2>(2.0 * a_c.j2s) - power_of<2>(a_c.j3)));
+        return integrated_h_3(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_h_4(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return sqrt(2.0) * a_c.j8 / sqrt(-a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
+        return integrated_h_4(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_h_5(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return -a_c.j9 / sqrt(power_of<2>(2.0 * a_c.j2s) + power_of<2>(a_c.j3));
+        return integrated_h_5(prepare(s_min, s_max));
     }
 
     double
@@ -1836,183 +1781,127 @@ namespace eos
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_1c(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j1c;
+        return integrated_j_1c(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_1s(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j1s;
+        return integrated_j_1s(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_2c(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j2c;
+        return integrated_j_2c(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_2s(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j2s;
+        return integrated_j_2s(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_3(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j3;
+        return integrated_j_3(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_3_normalized(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j3 / decay_width(a_c);
+        return integrated_j_3_normalized(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_3_normalized_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        return (a_c.j3 + a_c_bar.j3) / (decay_width(a_c) + decay_width(a_c_bar));
+        return integrated_j_3_normalized_cp_averaged(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_4(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j4;
+        return integrated_j_4(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_4_normalized_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        return (a_c.j4 + a_c_bar.j4) / (decay_width(a_c) + decay_width(a_c_bar));
+        return integrated_j_4_normalized_cp_averaged(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_5(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j5;
+        return integrated_j_5(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_5_normalized_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        return (a_c.j5 + a_c_bar.j5) / (decay_width(a_c) + decay_width(a_c_bar));
+        return integrated_j_5_normalized_cp_averaged(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_6c(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j6c;
+        return integrated_j_6c(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_6s(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j6s;
+        return integrated_j_6s(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_7(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j7;
+        return integrated_j_7(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_7_normalized_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        return (a_c.j7 + a_c_bar.j7) / (decay_width(a_c) + decay_width(a_c_bar));
+        return integrated_j_7_normalized_cp_averaged(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_8(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j8;
+        return integrated_j_8(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_8_normalized_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        return (a_c.j8 + a_c_bar.j8) / (decay_width(a_c) + decay_width(a_c_bar));
+        return integrated_j_8_normalized_cp_averaged(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_9(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j9;
+        return integrated_j_9(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_9_normalized(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return a_c.j9 / decay_width(a_c);
+        return integrated_j_9_normalized(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_j_9_normalized_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        return (a_c.j9 + a_c_bar.j9) / (decay_width(a_c) + decay_width(a_c_bar));
+        return integrated_j_9_normalized_cp_averaged(prepare(s_min, s_max));
     }
 
     double
     BToKstarDilepton<LargeRecoil>::integrated_a_9(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->cp_conjugate, false);
-
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
-
-        return (a_c.j9 - a_c_bar.j9) / (decay_width(a_c) + decay_width(a_c_bar));
+        return integrated_a_9(prepare(s_min, s_max));
     }
 
     double
@@ -2104,6 +1993,357 @@ namespace eos
         return br_muons / br_electrons;
     }
 
+    const BToKstarDilepton<LargeRecoil>::IntermediateResult *
+    BToKstarDilepton<LargeRecoil>::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_branching_ratio(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return decay_width(a_c) * _imp->tau() / _imp->hbar();
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_branching_ratio_cp_averaged(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return 0.5 * (decay_width(a_c) + decay_width(a_c_bar)) * _imp->tau() / _imp->hbar();
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_cp_asymmetry(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        double gamma     = decay_width(a_c);
+        double gamma_bar = decay_width(a_c_bar);
+        return (gamma - gamma_bar) / (gamma + gamma_bar);
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_forward_backward_asymmetry(const IntermediateResult * ir) const
+    {
+        // cf. [BHvD2010], eq. (2.8), p. 6
+        // cf. [BHvD2012], eq. (A7)
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return (a_c.j6s + 0.5 * a_c.j6c) / decay_width(a_c);
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_forward_backward_asymmetry_cp_averaged(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        double a_fb     = (a_c.j6s     + 0.5 * a_c.j6c)     / decay_width(a_c);
+        double a_fb_bar = (a_c_bar.j6s + 0.5 * a_c_bar.j6c) / decay_width(a_c_bar);
+        return 0.5 * (a_fb + a_fb_bar);
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_longitudinal_polarisation(const IntermediateResult * ir) const
+    {
+        // cf. [BHvD2012], eq. (A9)
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return (a_c.j1c - a_c.j2c / 3.0) / decay_width(a_c);
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_longitudinal_polarisation_cp_averaged(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        double f_l     = (a_c.j1c     - a_c.j2c     / 3.0) / decay_width(a_c);
+        double f_l_bar = (a_c_bar.j1c - a_c_bar.j2c / 3.0) / decay_width(a_c_bar);
+        return 0.5 * (f_l + f_l_bar);
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_transversal_polarisation(const IntermediateResult * ir) const
+    {
+        // cf. [BHvD2012], eq. (A10)
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return 2.0 * (a_c.j1s - a_c.j2s / 3.0) / decay_width(a_c);
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_transversal_polarisation_cp_averaged(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        double f_t     = 2.0 * (a_c.j1s     - a_c.j2s     / 3.0) / decay_width(a_c);
+        double f_t_bar = 2.0 * (a_c_bar.j1s - a_c_bar.j2s / 3.0) / decay_width(a_c_bar);
+        return 0.5 * (f_t + f_t_bar);
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_2(const IntermediateResult * ir) const
+    {
+        // cf. [BHvD2010], eq. (2.10), p. 6
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return 0.5 * a_c.j3 / a_c.j2s;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_2_cp_averaged(const IntermediateResult * ir) const
+    {
+        // cf. [BHvD2010], eq. (2.10), p. 6
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return 0.5 * (0.5 * a_c.j3 / a_c.j2s + 0.5 * a_c_bar.j3 / a_c_bar.j2s);
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_3(const IntermediateResult * ir) const
+    {
+        // cf. [BHvD2010], eq. (2.11), p. 6
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return sqrt((4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)) / (-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3)));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_4(const IntermediateResult * ir) const
+    {
+        // cf. [BHvD2010], eq. (2.12), p. 6
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return sqrt((power_of<2>(a_c.j5) + 4.0 * power_of<2>(a_c.j8)) / (4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_5(const IntermediateResult * ir) const
+    {
+        // cf. [BS2011], eq. (34), p. 9 for the massless case
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return std::sqrt(16.0 * power_of<2>(a_c.j2s) - power_of<2>(a_c.j6s) - 4.0 * (power_of<2>(a_c.j3) + power_of<2>(a_c.j9)))
+            / 8.0 / a_c.j2s;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_re(const IntermediateResult * ir) const
+    {
+        // cf. [BS2011], eq. (38), p. 10
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return 0.25 * a_c.j6s / a_c.j2s;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_im(const IntermediateResult * ir) const
+    {
+        // cf. [BS2011], eq. (30), p. 8
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return 0.5 * a_c.j9 / a_c.j2s;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_p_prime_4(const IntermediateResult * ir) const
+    {
+        // cf. [DMRV2012], p. 9, eq. (15)
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return (a_c.j4 + a_c_bar.j4) / std::sqrt(-1.0 * (a_c.j2c + a_c_bar.j2c) * (a_c.j2s + a_c_bar.j2s));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_p_prime_5(const IntermediateResult * ir) const
+    {
+        // cf. [DMRV2012], p. 9, eq. (16)
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return (a_c.j5 + a_c_bar.j5) / (2.0 * std::sqrt(-1.0 * (a_c.j2c + a_c_bar.j2c) * (a_c.j2s + a_c_bar.j2s)));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_p_prime_6(const IntermediateResult * ir) const
+    {
+        // cf. [DMRV2012], p. 9, eq. (17)
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return -1.0 * (a_c.j7 + a_c_bar.j7) / (2.0 * std::sqrt(-1.0 * (a_c.j2c + a_c_bar.j2c) * (a_c.j2s + a_c_bar.j2s)));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_h_1(const IntermediateResult * ir) const
+    {
+        // cf. [BHvD2010], p. 7, eq. (2.13)
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return sqrt(2.0) * a_c.j4 / sqrt(-a_c.j2c * (2.0 * a_c.j2s - a_c.j3));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_h_2(const IntermediateResult * ir) const
+    {
+        // cf. [BHvD2010], p. 7, eq. (2.14)
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return  a_c.j5 / sqrt(-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_h_3(const IntermediateResult * ir) const
+    {
+        // cf. [BHvD2010], p. 7, eq. (2.15)
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return a_c.j6s / (2.0 * sqrt(power_of<2>(2.0 * a_c.j2s) - power_of<2>(a_c.j3)));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_h_4(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return sqrt(2.0) * a_c.j8 / sqrt(-a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_h_5(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return -a_c.j9 / sqrt(power_of<2>(2.0 * a_c.j2s) + power_of<2>(a_c.j3));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_1c(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j1c;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_1s(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j1s;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_2c(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j2c;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_2s(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j2s;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_3(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j3;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_3_normalized(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return a_c.j3 / decay_width(a_c);
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_3_normalized_cp_averaged(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return (a_c.j3 + a_c_bar.j3) / (decay_width(a_c) + decay_width(a_c_bar));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_4(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j4;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_4_normalized_cp_averaged(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return (a_c.j4 + a_c_bar.j4) / (decay_width(a_c) + decay_width(a_c_bar));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_5(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j5;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_5_normalized_cp_averaged(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return (a_c.j5 + a_c_bar.j5) / (decay_width(a_c) + decay_width(a_c_bar));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_6c(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j6c;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_6s(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j6s;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_7(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j7;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_7_normalized_cp_averaged(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return (a_c.j7 + a_c_bar.j7) / (decay_width(a_c) + decay_width(a_c_bar));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_8(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j8;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_8_normalized_cp_averaged(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return (a_c.j8 + a_c_bar.j8) / (decay_width(a_c) + decay_width(a_c_bar));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_9(const IntermediateResult * ir) const
+    {
+        return array_to_angular_coefficients(ir->j).j9;
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_9_normalized(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c = array_to_angular_coefficients(ir->j);
+        return a_c.j9 / decay_width(a_c);
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_j_9_normalized_cp_averaged(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return (a_c.j9 + a_c_bar.j9) / (decay_width(a_c) + decay_width(a_c_bar));
+    }
+
+    double
+    BToKstarDilepton<LargeRecoil>::integrated_a_9(const IntermediateResult * ir) const
+    {
+        AngularCoefficients a_c, a_c_bar;
+        std::tie(a_c, a_c_bar) = _imp->cp_angular_coefficients(ir);
+        return (a_c.j9 - a_c_bar.j9) / (decay_width(a_c) + decay_width(a_c_bar));
+    }
+
     double
     BToKstarDilepton<LargeRecoil>::four_differential_decay_width(const double & s, const double & c_theta_l_LHCb, const double & c_theta_k_LHCb, const double & phi_LHCb) const
     {
@@ -2355,11 +2595,11 @@ The azimuthal angle between the Kbar-pi plane and the l^+l^- plane using the LHC
             complex<double> C1f_top_psd = 1.0 * (c7eff + wc.c7prime()) * (8.0 * std::log(m_b_PS / mu) + 2.0 * L - 4.0 * (1.0 - mu_f() / m_b_PS));
             // cf. [BHP2007], Eq. (B.2) and [BFS2001], Eqs. (38), p. 9
             complex<double> C1nf_top_psd = -(+1.0 / QCD::casimir_f) * (
-                    (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole)
+                    (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
                     + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
                     + (m_B / (2.0 * m_b_PS)) * (
-                        wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
-                        + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
+                        wc.c1() * memoise(CharmLoops::F19_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
+                        + wc.c2() * memoise(CharmLoops::F29_massive_expansion, mu(), m_b_PS, m_c_pole)(s)
                         + c8eff * CharmLoops::F89_massless(s, m_b_PS)));
 
             /* parallel, up sector */
@@ -2371,10 +2611,10 @@ The azimuthal angle between the Kbar-pi plane and the l^+l^- plane using the LHC
             // Use here FF_massive - FF_massless because FF_massless is defined with an extra '-'
             // compared to [S2004]
             complex<double> C1nf_up_psd = -(+1.0 / QCD::casimir_f) * (
-                    (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                    (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F27_massless(mu, s, m_b_PS))
                     + (m_B / (2.0 * m_b_PS)) * (
-                        wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                        + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                        wc.c1() * (memoise(CharmLoops::F19_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F19_massless(mu, s, m_b_PS))
+                        + wc.c2() * (memoise(CharmLoops::F29_massive_expansion, mu(), m_b_PS, m_c_pole)(s) - CharmLoops::F29_massless(mu, s, m_b_PS))));
 
             // compute the factorizing contributions
             complex<double> C_psd = C0_top_psd + lambda_hat_u * C0_up_psd
@@ -2590,6 +2830,24 @@ The azimuthal angle between the Kbar-pi plane and the l^+l^- plane using the LHC
 
             return b_l(wc, s);
         }
+
+        // numerator of the flat term and unnormalized decay width, sharing the Wilson coefficients and a_l, c_l
+        std::array<double, 2> differential_flat_term_numerator_and_decay_width(const double & s) const
+        {
+            WilsonCoefficients<BToS> wc = wilson_coefficients();
+
+            const double a = a_l(wc, s), c = c_l(wc, s);
+
+            return {{ 2.0 * (a + c), 2.0 * (a + c / 3.0) }};
+        }
+
+        // numerator of the forward-backward asymmetry and unnormalized decay width, sharing the Wilson coefficients
+        std::array<double, 2> differential_forward_backward_asymmetry_numerator_and_decay_width(const double & s) const
+        {
+            WilsonCoefficients<BToS> wc = wilson_coefficients();
+
+            return {{ b_l(wc, s), 2.0 * (a_l(wc, s) + c_l(wc, s) / 3.0) }};
+        }
     };
 
     BToKDilepton<LargeRecoil>::BToKDilepton(const Parameters & parameters, const Options & options) :
@@ -2755,70 +3013,56 @@ The azimuthal angle between the Kbar-pi plane and the l^+l^- plane using the LHC
     double
     BToKDilepton<LargeRecoil>::integrated_flat_term(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> num = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::differential_flat_term_numerator),
-                _imp, std::placeholders::_1);
-        std::function<double (const double &)> denom = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::unnormalized_decay_width),
+        std::function<std::array<double, 2> (const double &)> integrand = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::differential_flat_term_numerator_and_decay_width),
                 _imp, std::placeholders::_1);
 
-        double num_integrated = integrate<GSL::QNG>(num, s_min, s_max);
-        double denom_integrated = integrate<GSL::QNG>(denom, s_min, s_max);
+        const auto integrated = integrate<GSL::QNG>(integrand, s_min, s_max);
 
-        return num_integrated / denom_integrated;
+        return integrated[0] / integrated[1];
     }
 
     double
     BToKDilepton<LargeRecoil>::integrated_flat_term_cp_averaged(const double & s_min, const double & s_max) const
     {
         Save<bool> save(_imp->cp_conjugate, false);
-        std::function<double (const double &)> num = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::differential_flat_term_numerator),
-                _imp, std::placeholders::_1);
-        std::function<double (const double &)> denom = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::unnormalized_decay_width),
+        std::function<std::array<double, 2> (const double &)> integrand = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::differential_flat_term_numerator_and_decay_width),
                 _imp, std::placeholders::_1);
 
-        double num_integrated = integrate<GSL::QNG>(num, s_min, s_max);
-        double denom_integrated = integrate<GSL::QNG>(denom, s_min, s_max);
+        const auto integrated = integrate<GSL::QNG>(integrand, s_min, s_max);
 
         _imp->cp_conjugate = true;
 
-        num_integrated += integrate<GSL::QNG>(num, s_min, s_max);
-        denom_integrated += integrate<GSL::QNG>(denom, s_min, s_max);
+        const auto integrated_bar = integrate<GSL::QNG>(integrand, s_min, s_max);
 
-        return num_integrated / denom_integrated;
+        return (integrated[0] + integrated_bar[0]) / (integrated[1] + integrated_bar[1]);
     }
 
     // todo caching of denominator?
     double
     BToKDilepton<LargeRecoil>::integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> num = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::differential_forward_backward_asymmetry_numerator),
-                _imp, std::placeholders::_1);
-        std::function<double (const double &)> denom = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::unnormalized_decay_width),
+        std::function<std::array<double, 2> (const double &)> integrand = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::differential_forward_backward_asymmetry_numerator_and_decay_width),
                 _imp, std::placeholders::_1);
 
-        double num_integrated = integrate<GSL::QNG>(num, s_min, s_max);
-        double denom_integrated = integrate<GSL::QNG>(denom, s_min, s_max);
+        const auto integrated = integrate<GSL::QNG>(integrand, s_min, s_max);
 
-        return num_integrated / denom_integrated;
+        return integrated[0] / integrated[1];
     }
 
     double
     BToKDilepton<LargeRecoil>::integrated_forward_backward_asymmetry_cp_averaged(const double & s_min, const double & s_max) const
     {
         Save<bool> save(_imp->cp_conjugate, false);
-        std::function<double (const double &)> num = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::differential_forward_backward_asymmetry_numerator),
-                _imp, std::placeholders::_1);
-        std::function<double (const double &)> denom = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::unnormalized_decay_width),
+        std::function<std::array<double, 2> (const double &)> integrand = std::bind(std::mem_fn(&Implementation<BToKDilepton<LargeRecoil>>::differential_forward_backward_asymmetry_numerator_and_decay_width),
                 _imp, std::placeholders::_1);
 
-        double num_integrated = integrate<GSL::QNG>(num, s_min, s_max);
-        double denom_integrated = integrate<GSL::QNG>(denom, s_min, s_max);
+        const auto integrated = integrate<GSL::QNG>(integrand, s_min, s_max);
 
         _imp->cp_conjugate = true;
 
-        num_integrated += integrate<GSL::QNG>(num, s_min, s_max);
-        denom_integrated += integrate<GSL::QNG>(denom, s_min, s_max);
+        const auto integrated_bar = integrate<GSL::QNG>(integrand, s_min, s_max);
 
-        return num_integrated / denom_integrated;
+        return (integrated[0] + integrated_bar[0]) / (integrated[1] + integrated_bar[1]);
     }
 
     double
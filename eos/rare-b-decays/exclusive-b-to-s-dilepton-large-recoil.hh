@@ -24,11 +24,14 @@
 #define EOS_GUARD_SRC_RARE_B_DECAYS_EXCLUSIVE_B_TO_S_DILEPTON_LARGE_RECOIL_HH 1
 
 #include <eos/decays.hh>
+#include <eos/observable.hh>
 #include <eos/utils/complex.hh>
 #include <eos/utils/options.hh>
 #include <eos/utils/parameters.hh>
 #include <eos/utils/private_implementation_pattern.hh>
 
+#include <array>
+
 namespace eos
 {
     /*
@@ -164,6 +167,68 @@ namespace eos
             double integrated_d_6s(const double & s_min, const double & s_max) const;
             double integrated_ratio_muons_electrons(const double & s_min, const double & s_max) const;
 
+            // Integrated Observables, cacheable across observables in the same q^2 bin
+            struct IntermediateResult :
+                public CacheableObservable::IntermediateResult
+            {
+                // the integration range in q^2
+                double s_min, s_max;
+
+                // integrated angular coefficients J_i for the CP mode selected by the options
+                std::array<double, 12> j;
+
+                // integrated angular coefficients J_i for the opposite CP mode
+                std::array<double, 12> j_bar;
+            };
+
+            const IntermediateResult * prepare(const double & s_min, const double & s_max) const;
+
+            double integrated_branching_ratio(const IntermediateResult *) const;
+            double integrated_branching_ratio_cp_averaged(const IntermediateResult *) const;
+            double integrated_cp_asymmetry(const IntermediateResult *) const;
+            double integrated_forward_backward_asymmetry(const IntermediateResult *) const;
+            double integrated_forward_backward_asymmetry_cp_averaged(const IntermediateResult *) const;
+            double integrated_longitudinal_polarisation(const IntermediateResult *) const;
+            double integrated_longitudinal_polarisation_cp_averaged(const IntermediateResult *) const;
+            double integrated_transversal_polarisation(const IntermediateResult *) const;
+            double integrated_transversal_polarisation_cp_averaged(const IntermediateResult *) const;
+            double integrated_transverse_asymmetry_2(const IntermediateResult *) const;
+            double integrated_transverse_asymmetry_2_cp_averaged(const IntermediateResult *) const;
+            double integrated_transverse_asymmetry_3(const IntermediateResult *) const;
+            double integrated_transverse_asymmetry_4(const IntermediateResult *) const;
+            double integrated_transverse_asymmetry_5(const IntermediateResult *) const;
+            double integrated_transverse_asymmetry_re(const IntermediateResult *) const;
+            double integrated_transverse_asymmetry_im(const IntermediateResult *) const;
+            double integrated_p_prime_4(const IntermediateResult *) const;
+            double integrated_p_prime_5(const IntermediateResult *) const;
+            double integrated_p_prime_6(const IntermediateResult *) const;
+            double integrated_h_1(const IntermediateResult *) const;
+            double integrated_h_2(const IntermediateResult *) const;
+            double integrated_h_3(const IntermediateResult *) const;
+            double integrated_h_4(const IntermediateResult *) const;
+            double integrated_h_5(const IntermediateResult *) const;
+            double integrated_j_1s(const IntermediateResult *) const;
+            double integrated_j_1c(const IntermediateResult *) const;
+            double integrated_j_2s(const IntermediateResult *) const;
+            double integrated_j_2c(const IntermediateResult *) const;
+            double integrated_j_3(const IntermediateResult *) const;
+            double integrated_j_3_normalized(const IntermediateResult *) const;
+            double integrated_j_3_normalized_cp_averaged(const IntermediateResult *) const;
+            double integrated_j_4(const IntermediateResult *) const;
+            double integrated_j_4_normalized_cp_averaged(const IntermediateResult *) const;
+            double integrated_j_5(const IntermediateResult *) const;
+            double integrated_j_5_normalized_cp_averaged(const IntermediateResult *) const;
+            double integrated_j_6s(const IntermediateResult *) const;
+            double integrated_j_6c(const IntermediateResult *) const;
+            double integrated_j_7(const IntermediateResult *) const;
+            double integrated_j_7_normalized_cp_averaged(const IntermediateResult *) const;
+            double integrated_j_8(const IntermediateResult *) const;
+            double integrated_j_8_normalized_cp_averaged(const IntermediateResult *) const;
+            double integrated_j_9(const IntermediateResult *) const;
+            double integrated_j_9_normalized(const IntermediateResult *) const;
+            double integrated_j_9_normalized_cp_averaged(const IntermediateResult *) const;
+            double integrated_a_9(const IntermediateResult *) const;
+
             /*!
              * Descriptions of the process and its kinematics.
              */
@@ -23,6 +23,7 @@
 #include <eos/observable.hh>
 #include <eos/rare-b-decays/exclusive-b-to-s-dilepton-large-recoil.hh>
 #include <eos/utils/complex.hh>
+#include <eos/utils/observable_cache.hh>
 #include <eos/utils/wilson-polynomial.hh>
 
 #include <array>
@@ -180,6 +181,105 @@ class BToKstarDileptonLargeRecoilBobethCompatibilityTest :
     }
 } b_to_kstar_dilepton_large_recoil_bobeth_compatibility_test;
 
+class BToKstarDileptonLargeRecoilCacheableTest :
+    public TestCase
+{
+    public:
+        BToKstarDileptonLargeRecoilCacheableTest() :
+            TestCase("b_to_kstar_dilepton_large_recoil_cacheable_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-10;
+
+            Parameters p = Parameters::Defaults();
+            // introduce CP violation, such that both CP modes differ
+            p["b->s::Im{c7}"] = 0.2;
+            p["b->smumu::Im{c9}"] = 0.5;
+            p["b->smumu::Im{c10}"] = 0.3;
+
+            Kinematics k
+            {
+                { "q2_min", 1.0 },
+                { "q2_max", 6.0 }
+            };
+
+            Options o
+            {
+                { "model",        "WilsonScan" },
+                { "form-factors", "KMPW2010"   },
+                { "l",            "mu"         },
+                { "q",            "d"          }
+            };
+
+            // copies of Options share their state, hence we construct the CP-conjugate options independently
+            Options o_bar
+            {
+                { "model",        "WilsonScan" },
+                { "form-factors", "KMPW2010"   },
+                { "l",            "mu"         },
+                { "q",            "d"          },
+                { "cp-conjugate", "true"       }
+            };
+
+            // uncached reference values, each computed with its own decay and CP mode
+            BToKstarDilepton<LargeRecoil> d(p, o), d_bar(p, o_bar);
+
+            const double br     = d.integrated_branching_ratio(1.0, 6.0);
+            const double br_bar = d_bar.integrated_branching_ratio(1.0, 6.0);
+            TEST_CHECK(std::abs(br - br_bar) > 1e-3 * br);
+
+            const double a_fb     = d.integrated_forward_backward_asymmetry(1.0, 6.0);
+            const double a_fb_bar = d_bar.integrated_forward_backward_asymmetry(1.0, 6.0);
+
+            // the CP-averaged observables and the CP asymmetry combine both CP modes, irrespective of the selected one
+            TEST_CHECK_RELATIVE_ERROR(0.5 * (br + br_bar),                  d.integrated_branching_ratio_cp_averaged(1.0, 6.0),     eps);
+            TEST_CHECK_RELATIVE_ERROR(0.5 * (br + br_bar),                  d_bar.integrated_branching_ratio_cp_averaged(1.0, 6.0), eps);
+            TEST_CHECK_RELATIVE_ERROR((br - br_bar) / (br + br_bar),        d.integrated_cp_asymmetry(1.0, 6.0),                    eps);
+            TEST_CHECK_RELATIVE_ERROR((br - br_bar) / (br + br_bar),        d_bar.integrated_cp_asymmetry(1.0, 6.0),                eps);
+            TEST_CHECK_RELATIVE_ERROR(0.5 * (a_fb + a_fb_bar),              d.integrated_forward_backward_asymmetry_cp_averaged(1.0, 6.0), eps);
+
+            // cached observables share one intermediate result, which holds the integrals of both CP modes
+            for (const auto & options : { o, o_bar })
+            {
+                static const std::vector<std::string> names
+                {
+                    "B->K^*ll::BR@LargeRecoil",
+                    "B->K^*ll::A_FB@LargeRecoil",
+                    "B->K^*ll::F_L@LargeRecoil",
+                    "B->K^*ll::BRavg@LargeRecoil",
+                    "B->K^*ll::A_CP@LargeRecoil",
+                    "B->K^*ll::P'_5@LargeRecoil",
+                    "B->K^*ll::J_9normavg@LargeRecoil",
+                };
+
+                ObservableCache cache(p);
+                std::vector<ObservableCache::Id> ids;
+                std::vector<ObservablePtr> uncached;
+                for (const auto & name : names)
+                {
+                    ids.push_back(cache.add(Observable::make(name, p, k, options)));
+                    uncached.push_back(Observable::make(name, p, k, options));
+                }
+
+                for (unsigned update = 0 ; update < 2 ; ++update)
+                {
+                    cache.update();
+
+                    for (unsigned i = 0 ; i < names.size() ; ++i)
+                    {
+                        TEST_CHECK_RELATIVE_ERROR(uncached[i]->evaluate(), cache[ids[i]], eps);
+                    }
+
+                    // invalidate the intermediate result
+                    p["b->smumu::Re{c9}"] = p["b->smumu::Re{c9}"]() + 0.5;
+                }
+            }
+        }
+} b_to_kstar_dilepton_large_recoil_cacheable_test;
+
 class BToKDileptonLargeRecoilBobethCompatibilityTest :
     public TestCase
 {
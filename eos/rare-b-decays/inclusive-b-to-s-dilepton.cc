@@ -357,7 +357,7 @@ namespace eos
             /* Corrections, cf. [HLMW2005], Table 6, p. 18 */
             std::vector<complex<double>> m7 = {
                 -pow(alpha_s_tilde, 2) * kappa * memoise(CharmLoops::F17_massive, mu(), s, m_b_msbar, m_c),
-                -pow(alpha_s_tilde, 2) * kappa * memoise(CharmLoops::F27_massive, mu(), s, m_b_msbar, m_c),
+                -pow(alpha_s_tilde, 2) * kappa * memoise(CharmLoops::F27_massive_expansion, mu(), m_b_msbar, m_c)(s),
                 0.0,
                 0.0,
                 0.0,
@@ -373,8 +373,8 @@ namespace eos
             };
 
             std::vector<complex<double>> m9 = {
-                alpha_s_tilde * kappa * f(1, s_hat) - pow(alpha_s_tilde, 2) * kappa * memoise(CharmLoops::F19_massive, mu(), s, m_b_msbar, m_c),
-                alpha_s_tilde * kappa * f(2, s_hat) - pow(alpha_s_tilde, 2) * kappa * memoise(CharmLoops::F29_massive, mu(), s, m_b_msbar, m_c),
+                alpha_s_tilde * kappa * f(1, s_hat) - pow(alpha_s_tilde, 2) * kappa * memoise(CharmLoops::F19_massive_expansion, mu(), m_b_msbar, m_c)(s),
+                alpha_s_tilde * kappa * f(2, s_hat) - pow(alpha_s_tilde, 2) * kappa * memoise(CharmLoops::F29_massive_expansion, mu(), m_b_msbar, m_c)(s),
                 alpha_s_tilde * kappa * f(3, s_hat),
                 alpha_s_tilde * kappa * f(4, s_hat),
                 alpha_s_tilde * kappa * f(5, s_hat),
@@ -28,6 +28,7 @@
 #include <eos/rare-b-decays/b-to-kstar-charmonium.hh>
 #include <eos/rare-b-decays/b-to-k-charmonium.hh>
 #include <eos/rare-b-decays/nonlocal-formfactors.hh>
+#include <eos/utils/concrete-cacheable-observable.hh>
 #include <eos/utils/concrete_observable.hh>
 
 namespace eos
@@ -593,79 +594,98 @@ namespace eos
                         &BToKstarDilepton<LargeRecoil>::differential_ratio_muons_electrons,
                         std::make_tuple("q2")),
 
-                make_observable("B->K^*ll::A_FB@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::A_FB@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_forward_backward_asymmetry,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_FBavg@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::A_FBavg@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_forward_backward_asymmetry_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::BR@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::BR@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::BRavg@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::BRavg@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_branching_ratio_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_CP@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::A_CP@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_cp_asymmetry,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::F_L@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::F_L@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_longitudinal_polarisation,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::F_Lavg@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::F_Lavg@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_longitudinal_polarisation_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::F_T@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::F_T@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_transversal_polarisation,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::F_Tavg@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::F_Tavg@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_transversal_polarisation_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^2@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::A_T^2@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_2,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^2avg@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::A_T^2avg@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_2_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^3@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::A_T^3@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^4@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::A_T^4@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^5@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::A_T^5@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^re@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::A_T^re@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_re,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^im@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::A_T^im@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_transverse_asymmetry_im,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::P'_4@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::P'_4@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_p_prime_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::P'_5@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::P'_5@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_p_prime_5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::P'_6@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::P'_6@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_p_prime_6,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -689,23 +709,28 @@ namespace eos
                         &BToKstarDilepton<LargeRecoil>::differential_h_5,
                         std::make_tuple("q2")),
 
-                make_observable("B->K^*ll::H_T^1@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::H_T^1@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_h_1,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::H_T^2@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::H_T^2@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_h_2,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::H_T^3@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::H_T^3@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_h_3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::H_T^4@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::H_T^4@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_h_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::H_T^5@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::H_T^5@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_h_5,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -716,95 +741,118 @@ namespace eos
                         &BToKstarDilepton<LargeRecoil>::integrated_decay_width,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_1s@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_1s@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_1s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_1c@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_1c@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_1c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_2s@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_2s@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_2s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_2c@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_2c@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_2c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_3@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_3@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_3norm@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_3norm@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_3_normalized,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_3normavg@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_3normavg@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_3_normalized_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_4@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_4@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_5@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_5@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_6s@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_6s@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_6s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_6c@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_6c@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_6c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_7@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_7@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_7,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_8@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_8@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_8,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_9@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_9@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_9,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_9norm@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_9norm@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_9_normalized,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_9normavg@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::J_9normavg@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_9_normalized_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_3@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::S_3@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_3_normalized_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_4@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::S_4@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_4_normalized_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_5@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::S_5@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_5_normalized_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_7@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::S_7@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_7_normalized_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_8@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::S_8@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_8_normalized_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_9@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::S_9@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_j_9_normalized_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_9@LargeRecoil",
+                make_cacheable_observable("B->K^*ll::A_9@LargeRecoil",
+                        &BToKstarDilepton<LargeRecoil>::prepare,
                         &BToKstarDilepton<LargeRecoil>::integrated_a_9,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -20,23 +20,31 @@
 
 #include <eos/statistics/log-likelihood.hh>
 #include <eos/statistics/test-statistic-impl.hh>
+#include <eos/utils/derivative.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/observable_cache.hh>
 #include <eos/utils/power_of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/verify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <exception>
+#include <functional>
 #include <limits>
 #include <map>
+#include <memory>
+#include <numeric>
 
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_cdf.h>
 #include <gsl/gsl_linalg.h>
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
 #include <gsl/gsl_roots.h>
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_sf_result.h>
@@ -123,6 +131,17 @@ namespace eos
                 return norm - power_of<2>(chi) / 2.0;
             }
 
+            virtual double evaluate_with_gradient(double * gradient, const double & scale) const
+            {
+                const double value = cache[id];
+                const double sigma = (value > mode) ? sigma_upper : sigma_lower;
+                const double chi = (value - mode) / sigma;
+
+                gradient[id] -= scale * chi / sigma;
+
+                return norm - power_of<2>(chi) / 2.0;
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
@@ -146,35 +165,38 @@ namespace eos
              * This procedure is used in both sample() and significance()
              */
 
-            virtual double sample(gsl_rng * rng) const
+            /*
+             * Draw the pull (obs - theory) / sigma of a sample observable, using the
+             * inverse-transform method. The fixed theory prediction cancels in the
+             * pull, and we can use the standard normal quantile for either half.
+             */
+            double sample_chi(gsl_rng * rng) const
             {
                 // find out if sample in upper or lower part
-                double u = gsl_rng_uniform(rng);
+                const double u = gsl_rng_uniform(rng);
 
                 // mirror and shift the distribution
                 const double & c_b = c_upper;
                 const double & a = sigma_lower, & b = sigma_upper;
 
-                // fixed theory prediction
-                const double & theory = cache[id];
-
-                // get a sample observable using the inverse-transform method
-                double obs, sigma;
                 if (u < b / (a + b))
-                {
-                    obs = gsl_cdf_gaussian_Pinv(u / c_b, b) + theory;
-                    sigma = b;
-                }
+                    return gsl_cdf_ugaussian_Pinv(u / c_b);
                 else
-                {
-                    obs = gsl_cdf_gaussian_Pinv(u - 0.5 * c_b, a) + theory;
-                    sigma = a;
-                }
+                    return gsl_cdf_ugaussian_Pinv(u - 0.5 * c_b);
+            }
 
+            virtual double sample(gsl_rng * rng) const
+            {
                 // calculate the properly normalized log likelihood
-                // note that we generate from theory,
-                const double chi = (theory - obs) / sigma;
-                return norm - power_of<2>(chi) / 2.0;
+                return norm - power_of<2>(sample_chi(rng)) / 2.0;
+            }
+
+            virtual void add_samples(gsl_rng * rng, const unsigned & n, double * results) const
+            {
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    results[i] += norm - power_of<2>(sample_chi(rng)) / 2.0;
+                }
             }
 
             virtual double significance() const
@@ -302,6 +324,16 @@ namespace eos
                 return norm + alpha * value - std::exp(value);
             }
 
+            virtual double evaluate_with_gradient(double * gradient, const double & scale) const
+            {
+                const double value = (cache[id] - nu) / lambda;
+                const double exp_value = std::exp(value);
+
+                gradient[id] += scale * (alpha - exp_value) / lambda;
+
+                return norm + alpha * value - exp_value;
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
@@ -536,6 +568,16 @@ namespace eos
                 return norm + (alpha * beta - 1) * std::log(z) - std::pow(z, beta);
             }
 
+            virtual double evaluate_with_gradient(double * gradient, const double & scale) const
+            {
+                const double z = (cache[id] - physical_limit) / theta;
+                const double z_pow_beta = std::pow(z, beta);
+
+                gradient[id] += scale * ((alpha * beta - 1) - beta * z_pow_beta) / (z * theta);
+
+                return norm + (alpha * beta - 1) * std::log(z) - z_pow_beta;
+            }
+
             inline double mode() const
             {
                 return physical_limit + theta * std::pow(alpha - 1 / beta, 1 / beta);
@@ -737,6 +779,37 @@ namespace eos
                 return ret_val;
             }
 
+            // the gradient of each component enters with its share of the mixture density
+            double evaluate_with_gradient(double * gradient, const double & scale) const
+            {
+                // use local storage, so that gradients can be computed concurrently
+                std::vector<double> values(components.size());
+
+                auto v = values.begin();
+                for (auto c = components.cbegin() ; c != components.cend() ; ++c, ++v)
+                    *v = (**c).evaluate();
+
+                const double max_val = *std::max_element(values.cbegin(), values.cend());
+                double result = 0.0;
+
+                v = values.begin();
+                for (auto w = weights.cbegin(); w != weights.cend() ; ++w, ++v)
+                {
+                    result += *w * std::exp(*v - max_val);
+                }
+
+                result = std::log(result) + max_val;
+
+                v = values.begin();
+                auto w = weights.cbegin();
+                for (auto c = components.cbegin() ; c != components.cend() ; ++c, ++v, ++w)
+                {
+                    (**c).evaluate_with_gradient(gradient, scale * *w * std::exp(*v - result));
+                }
+
+                return result;
+            }
+
             unsigned number_of_observations() const
             {
                 unsigned ret_val = 0;
@@ -745,9 +818,29 @@ namespace eos
                 return ret_val;
             }
 
-            double sample(gsl_rng * /*rng*/) const
+            /*
+             * Pick one component with probability proportional to its weight, and sample
+             * from it. Since the pseudo observations are not accessible, we neglect the
+             * contributions of all other components at the sampled point. The result
+             * is therefore a lower bound on the log likelihood of the mixture, which is
+             * exact in the limit of well-separated components.
+             *
+             * As in evaluate(), the component enters with its raw weight. The sum of all
+             * weights is only used to select the component.
+             */
+            double sample(gsl_rng * rng) const
             {
-                throw InternalError("LogLikelihoodBlock::MixtureBlock::sample() not implemented yet");
+                const double total = std::accumulate(weights.cbegin(), weights.cend(), 0.0);
+                const double u = gsl_rng_uniform(rng) * total;
+
+                unsigned k = 0;
+                double cumulative = weights[0];
+                while ((cumulative <= u) && (k + 1 < weights.size()))
+                {
+                    cumulative += weights[++k];
+                }
+
+                return std::log(weights[k]) + components[k]->sample(rng);
             }
 
             double significance() const
@@ -780,14 +873,22 @@ namespace eos
             // the normalization constant of the density
             const double _norm;
 
-            // cholesky matrix of covariance, and inverse of covariance
+            // cholesky matrix L of covariance, with covariance = L * L^T
             gsl_matrix * _chol;
-            gsl_matrix * _covariance_inv;
 
-            // temporary storage for evaluation
+            // response matrix and mean, whitened by the cholesky matrix:
+            //   whitened_response = inv(L) * response
+            //   whitened_mean     = inv(L) * mean
+            // such that chi^2 = |whitened_response * observables - whitened_mean|^2
+            gsl_matrix * _whitened_response;
+            gsl_vector * _whitened_mean;
+
+            // up to this dimension, chi_square() uses storage on the stack and avoids BLAS calls
+            static constexpr unsigned max_stack_dimension = 64;
+
+            // temporary storage for evaluation in higher dimensions
             gsl_vector * _observables;
             gsl_vector * _measurements;
-            gsl_vector * _measurements_2;
 
             MultivariateGaussianBlock(const ObservableCache & cache, const std::vector<ObservableCache::Id> && ids,
                     gsl_vector * mean, gsl_matrix * covariance, gsl_matrix * response, const unsigned & number_of_observations) :
@@ -801,10 +902,10 @@ namespace eos
                 _number_of_observations(number_of_observations),
                 _norm(compute_norm()),
                 _chol(gsl_matrix_alloc(covariance->size1, covariance->size2)),
-                _covariance_inv(gsl_matrix_alloc(covariance->size1, covariance->size2)),
+                _whitened_response(gsl_matrix_alloc(response->size1, response->size2)),
+                _whitened_mean(gsl_vector_alloc(mean->size)),
                 _observables(gsl_vector_alloc(_dim_pred)),
-                _measurements(gsl_vector_alloc(_dim_meas)),
-                _measurements_2(gsl_vector_alloc(_dim_meas))
+                _measurements(gsl_vector_alloc(_dim_meas))
             {
                 if (_covariance->size1 != _covariance->size2)
                     throw InternalError("MultivariateGaussianBlock: covariance matrix is not a square matrix");
@@ -821,7 +922,6 @@ namespace eos
                 // cholesky decomposition (informally: the sqrt of the covariance matrix)
                 // the GSL matrix contains both the cholesky and its transpose, see GSL reference, ch. 14.5
                 cholesky();
-                invert_covariance();
 
                 // keep only the lower and diagonal parts, set upper parts to zero
                 for (unsigned i = 0; i < _dim_meas ; ++i)
@@ -831,16 +931,18 @@ namespace eos
                         gsl_matrix_set(_chol, i, j, 0.0);
                     }
                 }
+
+                whiten();
             }
 
             virtual ~MultivariateGaussianBlock()
             {
-                gsl_matrix_free(_covariance_inv);
+                gsl_matrix_free(_whitened_response);
                 gsl_matrix_free(_chol);
                 gsl_matrix_free(_covariance);
                 gsl_matrix_free(_response);
 
-                gsl_vector_free(_measurements_2);
+                gsl_vector_free(_whitened_mean);
                 gsl_vector_free(_measurements);
                 gsl_vector_free(_observables);
                 gsl_vector_free(_mean);
@@ -867,16 +969,21 @@ namespace eos
                     result += ")";
                 }
                 result += "), inverse covariance matrix = (";
+                gsl_matrix * covariance_inv = gsl_matrix_alloc(k, k);
+                gsl_matrix_memcpy(covariance_inv, _covariance);
+                gsl_linalg_cholesky_decomp(covariance_inv);
+                gsl_linalg_cholesky_invert(covariance_inv);
                 for (std::size_t i = 0 ; i < k ; ++i)
                 {
                     result += "( ";
                     for (std::size_t j = 0 ; j < k ; ++j)
                     {
-                        result += stringify(gsl_matrix_get(_covariance_inv, i, j)) + " ";
+                        result += stringify(gsl_matrix_get(covariance_inv, i, j)) + " ";
                     }
                     result += ")";
                 }
                 result += " )";
+                gsl_matrix_free(covariance_inv);
 
                 if (0 == _number_of_observations)
                     result += "; no observation";
@@ -892,17 +999,18 @@ namespace eos
                 gsl_linalg_cholesky_decomp(_chol);
             }
 
-            // invert covariance matrix based on previously obtained Cholesky decomposition
-            void invert_covariance()
+            // whiten response matrix and mean based on previously obtained Cholesky decomposition
+            void whiten()
             {
-                // copy cholesky matrix
-                gsl_matrix_memcpy(_covariance_inv, _chol);
+                // whitened_response <- inv(L) * response, by forward substitution
+                gsl_matrix_memcpy(_whitened_response, _response);
+                gsl_blas_dtrsm(CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0, _chol, _whitened_response);
 
-                // compute inverse matrix from cholesky
-                gsl_linalg_cholesky_invert(_covariance_inv);
+                // whitened_mean <- inv(L) * mean, by forward substitution
+                gsl_vector_memcpy(_whitened_mean, _mean);
+                gsl_blas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit, _chol, _whitened_mean);
             }
 
-
             virtual LogLikelihoodBlockPtr clone(ObservableCache cache) const
             {
                 const auto dim_meas = _mean->size;
@@ -952,25 +1060,49 @@ namespace eos
 
             double chi_square() const
             {
-                // read observable values from cache, and subtract mean
+                if ((_dim_pred <= max_stack_dimension) && (_dim_meas <= max_stack_dimension))
+                {
+                    // read observable values from cache
+                    double observables[max_stack_dimension];
+                    for (auto i = 0u ; i < _dim_pred ; ++i)
+                    {
+                        observables[i] = _cache[_ids[i]];
+                    }
+
+                    // accumulate the squares of the whitened residuals
+                    double result = 0.0;
+                    for (auto j = 0u ; j < _dim_meas ; ++j)
+                    {
+                        const double * row = gsl_matrix_const_ptr(_whitened_response, j, 0);
+
+                        double residual = -gsl_vector_get(_whitened_mean, j);
+                        for (auto i = 0u ; i < _dim_pred ; ++i)
+                        {
+                            residual += row[i] * observables[i];
+                        }
+
+                        result += residual * residual;
+                    }
+
+                    return result;
+                }
+
+                // read observable values from cache
                 for (auto i = 0u ; i < _dim_pred ; ++i)
                 {
                     gsl_vector_set(_observables, i, _cache[_ids[i]]);
                 }
 
                 // prepare for centering
-                //   measurements <- mean
-                gsl_vector_memcpy(_measurements, _mean);
+                //   measurements <- inv(L) * mean
+                gsl_vector_memcpy(_measurements, _whitened_mean);
 
-                // apply response matrix and center the gaussian:
-                //   measurements <- R * observables - measurements
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _response, _observables, -1.0, _measurements);
-
-                // observables <- inv(covariance) * measurements
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _covariance_inv, _measurements, 0.0, _measurements_2);
+                // apply whitened response matrix and center the gaussian:
+                //   measurements <- inv(L) * (R * observables - mean)
+                gsl_blas_dgemv(CblasNoTrans, 1.0, _whitened_response, _observables, -1.0, _measurements);
 
                 double result;
-                gsl_blas_ddot(_measurements, _measurements_2, &result);
+                gsl_blas_ddot(_measurements, _measurements, &result);
 
                 return result;
             }
@@ -980,6 +1112,47 @@ namespace eos
                 return _norm - 0.5 * chi_square();
             }
 
+            // d log(L) / d observables = -R^T inv(L)^T inv(L) (R * observables - mean)
+            // Uses local storage only, so that gradients can be computed concurrently.
+            virtual double evaluate_with_gradient(double * gradient, const double & scale) const
+            {
+                std::vector<double> observables(_dim_pred), residuals(_dim_meas);
+                for (auto i = 0u ; i < _dim_pred ; ++i)
+                {
+                    observables[i] = _cache[_ids[i]];
+                }
+
+                // residuals <- inv(L) * (R * observables - mean)
+                double chi_squared = 0.0;
+                for (auto j = 0u ; j < _dim_meas ; ++j)
+                {
+                    const double * row = gsl_matrix_const_ptr(_whitened_response, j, 0);
+
+                    double residual = -gsl_vector_get(_whitened_mean, j);
+                    for (auto i = 0u ; i < _dim_pred ; ++i)
+                    {
+                        residual += row[i] * observables[i];
+                    }
+
+                    residuals[j] = residual;
+                    chi_squared += residual * residual;
+                }
+
+                // gradient <- gradient - scale * (inv(L) * R)^T * residuals
+                for (auto j = 0u ; j < _dim_meas ; ++j)
+                {
+                    const double * row = gsl_matrix_const_ptr(_whitened_response, j, 0);
+                    const double factor = scale * residuals[j];
+
+                    for (auto i = 0u ; i < _dim_pred ; ++i)
+                    {
+                        gradient[_ids[i]] -= factor * row[i];
+                    }
+                }
+
+                return _norm - 0.5 * chi_squared;
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
@@ -987,26 +1160,28 @@ namespace eos
 
             virtual double sample(gsl_rng * rng) const
             {
-                // generate standard normals in observables
-                for (auto i = 0u ; i < _dim_meas ; ++i)
-                {
-                    gsl_vector_set(_measurements, i, gsl_ran_ugaussian(rng));
-                }
-
-                // transform: observables2 <- _chol * observables
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _chol, _measurements, 0.0, _measurements_2);
+                double result = 0.0;
+                add_samples(rng, 1u, &result);
 
-                // To be consistent with the univariate Gaussian, we would center observables around theory,
-                // then compare to theory. Hence we can forget about theory, and stay centered on zero.
-                // transform: observables <- inv(covariance) * observables2
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _covariance_inv, _measurements_2, 0.0, _measurements);
+                return result;
+            }
 
-                double result;
-                gsl_blas_ddot(_measurements, _measurements_2, &result);
-                result *= -0.5;
-                result += _norm;
+            // To be consistent with the univariate Gaussian, we would center observables around theory,
+            // then compare to theory. Hence we can forget about theory, and stay centered on zero.
+            // For a sample L * z with standard normals z, chi^2 is the sum of squares of z.
+            // No member storage is used, so that several threads can sample concurrently.
+            virtual void add_samples(gsl_rng * rng, const unsigned & n, double * results) const
+            {
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    double chi_squared = 0.0;
+                    for (auto j = 0u ; j < _dim_meas ; ++j)
+                    {
+                        chi_squared += power_of<2>(gsl_ran_ugaussian(rng));
+                    }
 
-                return result;
+                    results[i] += _norm - 0.5 * chi_squared;
+                }
             }
 
             virtual double significance() const
@@ -1057,6 +1232,13 @@ namespace eos
                 return cache[id];
             }
 
+            virtual double evaluate_with_gradient(double * gradient, const double & scale) const
+            {
+                gradient[id] += scale;
+
+                return cache[id];
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return 0.0;
@@ -1084,12 +1266,270 @@ namespace eos
                 return LogLikelihoodBlockPtr(new UniformBoundBlock(cache, cache.add(observable)));
             }
         };
+
+        /*!
+         * Evaluation plan for the sum of the logarithms of many likelihood blocks.
+         *
+         * Univariate Gaussian, LogGamma and Amoroso blocks are grouped by type,
+         * and their parameters are stored in contiguous arrays. Each group is then
+         * evaluated in a single loop without virtual dispatch. All other blocks are
+         * evaluated through LogLikelihoodBlock::evaluate().
+         *
+         * All grouped blocks must draw their predictions from the same ObservableCache.
+         */
+        struct EvaluationPlan
+        {
+            struct GaussianGroup
+            {
+                std::vector<ObservableCache::Id> ids;
+                std::vector<double> mode, sigma_lower, sigma_upper, norm;
+            } gaussians;
+
+            struct LogGammaGroup
+            {
+                std::vector<ObservableCache::Id> ids;
+                std::vector<double> nu, lambda, alpha, norm;
+            } log_gammas;
+
+            struct AmorosoGroup
+            {
+                std::vector<ObservableCache::Id> ids;
+                std::vector<double> physical_limit, theta, exponent, beta, norm;
+            } amorosos;
+
+            std::vector<LogLikelihoodBlockPtr> others;
+
+            void add(const LogLikelihoodBlockPtr & block)
+            {
+                if (auto b = dynamic_cast<const GaussianBlock *>(block.get()))
+                {
+                    gaussians.ids.push_back(b->id);
+                    gaussians.mode.push_back(b->mode);
+                    gaussians.sigma_lower.push_back(b->sigma_lower);
+                    gaussians.sigma_upper.push_back(b->sigma_upper);
+                    gaussians.norm.push_back(b->norm);
+                }
+                else if (auto b = dynamic_cast<const LogGammaBlock *>(block.get()))
+                {
+                    log_gammas.ids.push_back(b->id);
+                    log_gammas.nu.push_back(b->nu);
+                    log_gammas.lambda.push_back(b->lambda);
+                    log_gammas.alpha.push_back(b->alpha);
+                    log_gammas.norm.push_back(b->norm);
+                }
+                else if (auto b = dynamic_cast<const AmorosoBlock *>(block.get()))
+                {
+                    amorosos.ids.push_back(b->id);
+                    amorosos.physical_limit.push_back(b->physical_limit);
+                    amorosos.theta.push_back(b->theta);
+                    amorosos.exponent.push_back(b->alpha * b->beta - 1.0);
+                    amorosos.beta.push_back(b->beta);
+                    amorosos.norm.push_back(b->norm);
+                }
+                else
+                {
+                    others.push_back(block);
+                }
+            }
+
+            /*!
+             * Return the sum of the logarithms of all blocks, or -infinity if any of them is not finite.
+             *
+             * @param predictions The predictions of the common ObservableCache.
+             */
+            double evaluate(const double * predictions) const
+            {
+                double result = 0.0;
+
+                // the sum is not finite if any of its terms is not finite; we check only once at the end
+                const auto n_gaussians = gaussians.ids.size();
+                for (std::size_t i = 0 ; i < n_gaussians ; ++i)
+                {
+                    const double value = predictions[gaussians.ids[i]];
+
+                    // allow for asymmetric Gaussian uncertainty
+                    const double sigma = (value > gaussians.mode[i]) ? gaussians.sigma_upper[i] : gaussians.sigma_lower[i];
+                    const double chi = (value - gaussians.mode[i]) / sigma;
+
+                    result += gaussians.norm[i] - chi * chi / 2.0;
+                }
+
+                const auto n_log_gammas = log_gammas.ids.size();
+                for (std::size_t i = 0 ; i < n_log_gammas ; ++i)
+                {
+                    const double value = (predictions[log_gammas.ids[i]] - log_gammas.nu[i]) / log_gammas.lambda[i];
+
+                    result += log_gammas.norm[i] + log_gammas.alpha[i] * value - std::exp(value);
+                }
+
+                const auto n_amorosos = amorosos.ids.size();
+                for (std::size_t i = 0 ; i < n_amorosos ; ++i)
+                {
+                    const double z = (predictions[amorosos.ids[i]] - amorosos.physical_limit[i]) / amorosos.theta[i];
+
+                    result += amorosos.norm[i] + amorosos.exponent[i] * std::log(z) - std::pow(z, amorosos.beta[i]);
+                }
+
+                if (! std::isfinite(result))
+                    return -std::numeric_limits<double>::infinity();
+
+                for (const auto & b : others)
+                {
+                    double llh = b->evaluate();
+                    if (! std::isfinite(llh))
+                        return -std::numeric_limits<double>::infinity();
+
+                    result += llh;
+                }
+
+                return result;
+            }
+
+            /*!
+             * Return the sum of the logarithms of all blocks, or -infinity if any of them is not finite,
+             * and add the gradient with respect to the predictions to the respective elements of gradient.
+             *
+             * @param predictions The predictions of the common ObservableCache.
+             * @param gradient    Array indexed by ObservableCache::Id, with one element for each prediction.
+             */
+            double evaluate_with_gradient(const double * predictions, double * gradient) const
+            {
+                double result = 0.0;
+
+                const auto n_gaussians = gaussians.ids.size();
+                for (std::size_t i = 0 ; i < n_gaussians ; ++i)
+                {
+                    const double value = predictions[gaussians.ids[i]];
+
+                    // allow for asymmetric Gaussian uncertainty
+                    const double sigma = (value > gaussians.mode[i]) ? gaussians.sigma_upper[i] : gaussians.sigma_lower[i];
+                    const double chi = (value - gaussians.mode[i]) / sigma;
+
+                    gradient[gaussians.ids[i]] -= chi / sigma;
+                    result += gaussians.norm[i] - chi * chi / 2.0;
+                }
+
+                const auto n_log_gammas = log_gammas.ids.size();
+                for (std::size_t i = 0 ; i < n_log_gammas ; ++i)
+                {
+                    const double value = (predictions[log_gammas.ids[i]] - log_gammas.nu[i]) / log_gammas.lambda[i];
+                    const double exp_value = std::exp(value);
+
+                    gradient[log_gammas.ids[i]] += (log_gammas.alpha[i] - exp_value) / log_gammas.lambda[i];
+                    result += log_gammas.norm[i] + log_gammas.alpha[i] * value - exp_value;
+                }
+
+                const auto n_amorosos = amorosos.ids.size();
+                for (std::size_t i = 0 ; i < n_amorosos ; ++i)
+                {
+                    const double z = (predictions[amorosos.ids[i]] - amorosos.physical_limit[i]) / amorosos.theta[i];
+                    const double z_pow_beta = std::pow(z, amorosos.beta[i]);
+
+                    gradient[amorosos.ids[i]] += (amorosos.exponent[i] - amorosos.beta[i] * z_pow_beta) / (z * amorosos.theta[i]);
+                    result += amorosos.norm[i] + amorosos.exponent[i] * std::log(z) - z_pow_beta;
+                }
+
+                if (! std::isfinite(result))
+                    return -std::numeric_limits<double>::infinity();
+
+                for (const auto & b : others)
+                {
+                    double llh = b->evaluate_with_gradient(gradient, 1.0);
+                    if (! std::isfinite(llh))
+                        return -std::numeric_limits<double>::infinity();
+
+                    result += llh;
+                }
+
+                return result;
+            }
+        };
+
+        /*
+         * Counter-based random number generator for use through the gsl_rng interface.
+         *
+         * The n-th number of the stream with key k is obtained by applying the SplitMix64
+         * finalizer to k XOR the n-th element of a Weyl sequence. Any element of any stream
+         * can therefore be computed independently, and streams with different keys do not
+         * share any state. The key is passed as the seed to gsl_rng_set().
+         */
+        namespace counter_based_rng
+        {
+            struct State
+            {
+                std::uint64_t key;
+                std::uint64_t counter;
+            };
+
+            inline std::uint64_t mix(std::uint64_t z)
+            {
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+                return z ^ (z >> 31);
+            }
+
+            inline std::uint64_t next(void * state)
+            {
+                State * s = static_cast<State *>(state);
+                return mix(s->key ^ mix(++s->counter * 0x9e3779b97f4a7c15ull));
+            }
+
+            // key of the stream with the given index, derived from a common seed
+            inline unsigned long key(const std::uint64_t & seed, const std::uint64_t & stream)
+            {
+                return mix(mix(seed) + stream * 0x9e3779b97f4a7c15ull);
+            }
+
+            void set(void * state, unsigned long int seed)
+            {
+                State * s = static_cast<State *>(state);
+                s->key = seed;
+                s->counter = 0;
+            }
+
+            unsigned long int get(void * state)
+            {
+                return next(state) >> 32;
+            }
+
+            double get_double(void * state)
+            {
+                // 53 random bits, scaled to [0, 1)
+                return (next(state) >> 11) * (1.0 / 9007199254740992.0);
+            }
+
+            const gsl_rng_type type =
+            {
+                "eos-counter-based",
+                0xffffffffUL,
+                0,
+                sizeof(State),
+                &set,
+                &get,
+                &get_double
+            };
+        }
     }
 
     LogLikelihoodBlock::~LogLikelihoodBlock()
     {
     }
 
+    double
+    LogLikelihoodBlock::evaluate_with_gradient(double * /*gradient*/, const double & /*scale*/) const
+    {
+        throw InternalError("LogLikelihoodBlock::evaluate_with_gradient() not implemented for '" + this->as_string() + "'");
+    }
+
+    void
+    LogLikelihoodBlock::add_samples(gsl_rng * rng, const unsigned & n, double * results) const
+    {
+        for (unsigned i = 0 ; i < n ; ++i)
+        {
+            results[i] += this->sample(rng);
+        }
+    }
+
     LogLikelihoodBlockPtr
     LogLikelihoodBlock::Gaussian(ObservableCache cache, const ObservablePtr & observable,
             const double & min, const double & central, const double & max,
@@ -1238,6 +1678,9 @@ namespace eos
         // Container for all named constraints
         std::vector<Constraint> constraints;
 
+        // All blocks of all constraints, grouped for evaluation
+        implementation::EvaluationPlan plan;
+
         Implementation(const Parameters & parameters) :
             parameters(parameters),
             cache(parameters)
@@ -1257,10 +1700,13 @@ namespace eos
             double t_obs = 0;
 
             // set up for sampling
+            std::vector<const LogLikelihoodBlock *> blocks;
             for (auto c = constraints.cbegin(), c_end = constraints.cend() ; c != c_end ; ++c)
             {
                 for (auto b = c->begin_blocks(), b_end = c->end_blocks() ; b != b_end ; ++b)
                 {
+                    blocks.push_back(b->get());
+
                     if (! (*b)->number_of_observations())
                         continue;
                     t_obs += (*b)->evaluate();
@@ -1271,37 +1717,65 @@ namespace eos
                                      << "The value of the test statistic (total likelihood) "
                                      << "for the current parameters is = " << t_obs;
 
-            // count data sets with smaller likelihood
-            unsigned n_low = 0;
-
-            // test value
-            double t;
-
-            gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
-            gsl_rng_set(rng, datasets);
+            // Data sets are simulated in chunks of fixed size, each of which draws from its own
+            // random number stream. The result does therefore not depend on the number of threads.
+            static const unsigned datasets_per_stream = 1024;
+            const unsigned streams = (datasets + datasets_per_stream - 1) / datasets_per_stream;
 
             Log::instance()->message("log_likelihood.bootstrap_pvalue", ll_informational)
                                      << "Begin sampling " << datasets << " simulated "
-                                     << "values of the likelihood";
+                                     << "values of the likelihood in " << streams << " streams";
 
-            // collect samples
-            for (unsigned i = 0 ; i < datasets ; ++i)
+            // count data sets with smaller likelihood, per stream
+            std::vector<unsigned> n_low_per_stream(streams, 0u);
+            std::vector<std::exception_ptr> exceptions(streams);
+            std::vector<Ticket> tickets;
+            tickets.reserve(streams);
+
+            for (unsigned s = 0 ; s < streams ; ++s)
             {
-                t = 0.0;
-                for (auto c = constraints.cbegin(), c_end = constraints.cend() ; c != c_end ; ++c)
+                const unsigned begin = s * datasets_per_stream, size = std::min(datasets - begin, datasets_per_stream);
+                const unsigned long key = implementation::counter_based_rng::key(datasets, s);
+                const auto * blocks_ptr = &blocks;
+                unsigned * n_low = &n_low_per_stream[s];
+                std::exception_ptr * exception = &exceptions[s];
+
+                tickets.push_back(ThreadPool::instance()->enqueue([blocks_ptr, key, size, t_obs, n_low, exception]()
                 {
-                    for (auto b = c->begin_blocks(), b_end = c->end_blocks() ; b != b_end ; ++b)
+                    try
                     {
-                        t += (*b)->sample(rng);
+                        std::unique_ptr<gsl_rng, void (*)(gsl_rng *)> rng(gsl_rng_alloc(&implementation::counter_based_rng::type), &gsl_rng_free);
+                        gsl_rng_set(rng.get(), key);
+
+                        // test values, accumulated block by block
+                        std::vector<double> t(size, 0.0);
+                        for (const auto & b : *blocks_ptr)
+                        {
+                            b->add_samples(rng.get(), size, t.data());
+                        }
+
+                        *n_low = std::count_if(t.cbegin(), t.cend(), [t_obs](const double & t_i) { return t_i < t_obs; });
                     }
-                }
+                    catch (...)
+                    {
+                        *exception = std::current_exception();
+                    }
+                }));
+            }
 
-                if (t < t_obs)
-                {
-                    ++n_low;
-                }
+            for (auto & t : tickets)
+            {
+                t.wait();
+            }
+
+            for (auto & e : exceptions)
+            {
+                if (e)
+                    std::rethrow_exception(e);
             }
 
+            const unsigned n_low = std::accumulate(n_low_per_stream.cbegin(), n_low_per_stream.cend(), 0u);
+
             // mode of binomial posterior
             double p = n_low / double(datasets);
 
@@ -1314,29 +1788,12 @@ namespace eos
                                      << "The simulated p-value is " << p
                                      << " with uncertainty " << uncertainty;
 
-            gsl_rng_free(rng);
-
             return std::make_pair(p, uncertainty);
         }
 
         double log_likelihood() const
         {
-            double result = 0.0;
-
-            // loop over all likelihood blocks
-            for (auto c = constraints.cbegin(), c_end = constraints.cend() ; c != c_end ; ++c)
-            {
-                for (auto b = c->begin_blocks(), b_end = c->end_blocks() ; b != b_end ; ++b)
-                {
-                    double llh = (*b)->evaluate();
-                    if (! std::isfinite(llh))
-                        return -std::numeric_limits<double>::infinity();
-
-                    result += llh;
-                }
-            }
-
-            return result;
+            return plan.evaluate(cache.predictions());
         }
     };
 
@@ -1354,6 +1811,7 @@ namespace eos
             const unsigned & number_of_observations)
     {
         LogLikelihoodBlockPtr b = LogLikelihoodBlock::Gaussian(_imp->cache, observable, min, central, max, number_of_observations);
+        _imp->plan.add(b);
         _imp->constraints.push_back(
             Constraint(observable->name(), std::vector<ObservablePtr>{ observable }, std::vector<LogLikelihoodBlockPtr>{ b }));
     }
@@ -1368,6 +1826,7 @@ namespace eos
         {
             // Clone each LogLikelihoodBlock onto our ObservableCache
             blocks.push_back((*b)->clone(_imp->cache));
+            _imp->plan.add(blocks.back());
         }
 
         std::copy(constraint.begin_observables(), constraint.end_observables(), std::back_inserter(observables));
@@ -1442,4 +1901,70 @@ namespace eos
 
         return _imp->log_likelihood();
     }
+
+    double
+    LogLikelihood::evaluate_with_gradient(std::vector<double> & gradient) const
+    {
+        _imp->cache.update();
+
+        gradient.assign(_imp->cache.size(), 0.0);
+
+        const double result = _imp->plan.evaluate_with_gradient(_imp->cache.predictions(), gradient.data());
+
+        if (! std::isfinite(result))
+            std::fill(gradient.begin(), gradient.end(), 0.0);
+
+        return result;
+    }
+
+    double
+    LogLikelihood::evaluate_with_gradient(const std::vector<Parameter> & parameters, std::vector<double> & gradient) const
+    {
+        std::vector<double> prediction_gradient;
+        const double result = evaluate_with_gradient(prediction_gradient);
+
+        gradient.assign(parameters.size(), 0.0);
+
+        if (! std::isfinite(result))
+            return result;
+
+        ObservableCache & cache = _imp->cache;
+        const std::vector<double> predictions_0(cache.predictions(), cache.predictions() + cache.size());
+
+        for (auto k = 0u ; k < parameters.size() ; ++k)
+        {
+            Parameter p = parameters[k];
+            const double x0 = p.evaluate();
+
+            // projection of the change of the predictions onto the gradient, as a function of the k-th parameter;
+            // predictions that do not depend on the parameter drop out exactly
+            std::function<double (const double &)> f = [&](const double & x) -> double
+            {
+                p.set(x);
+                cache.update();
+
+                const double * predictions = cache.predictions();
+
+                double projection = 0.0;
+                for (auto j = 0u ; j < prediction_gradient.size() ; ++j)
+                {
+                    if (0.0 == prediction_gradient[j])
+                        continue;
+
+                    projection += prediction_gradient[j] * (predictions[j] - predictions_0[j]);
+                }
+
+                return projection;
+            };
+
+            gradient[k] = derivative<1u, deriv::TwoSided>(f, x0);
+
+            p.set(x0);
+        }
+
+        // restore the predictions at the original point
+        cache.update();
+
+        return result;
+    }
 }
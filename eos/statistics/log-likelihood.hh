@@ -61,6 +61,19 @@ namespace eos
             /// Compute the logarithm of the likelihood for this block.
             virtual double evaluate() const = 0;
 
+            /*!
+             * Compute the logarithm of the likelihood for this block, and its gradient
+             * with respect to the predictions of the block's observables.
+             *
+             * @param gradient Array indexed by ObservableCache::Id, with one element for each prediction
+             *                 in the block's cache. The elements of this block's observables are incremented
+             *                 by scale * d log(L) / d prediction.
+             * @param scale    Factor applied to the gradient, e.g. the share of a component within a mixture.
+             *
+             * The default implementation throws InternalError. All blocks provided by EOS override it.
+             */
+            virtual double evaluate_with_gradient(double * gradient, const double & scale) const;
+
             /// The number of experimental observations (not observables!) used in this block.
             virtual unsigned number_of_observations() const = 0;
 
@@ -74,6 +87,19 @@ namespace eos
              */
             virtual double sample(gsl_rng * rng) const = 0;
 
+            /*!
+             * Draw several samples from the logarithm of the likelihood for this block at once,
+             * and add them to the respective elements of results.
+             *
+             * The default implementation calls sample() n times. Blocks override this to
+             * hoist all work that does not depend on the random numbers out of the loop.
+             *
+             * @param rng     The random number generator.
+             * @param n       The number of samples.
+             * @param results Array of at least n elements to which the samples are added.
+             */
+            virtual void add_samples(gsl_rng * rng, const unsigned & n, double * results) const;
+
             /*!
              * Calculate the significance of the deviation between
              * the observables' current value and the mode in
@@ -365,6 +391,10 @@ namespace eos
              * @param  datasets The number of simulated data sets
              * @return <p-value, uncertainty>, where the uncertainty is
              * estimated from the standard posterior for a Bernoulli experiment.
+             *
+             * The data sets are simulated in parallel on the ThreadPool. Every chunk
+             * of data sets draws from its own counter-based random number stream, so
+             * that the result is reproducible regardless of the number of threads.
              */
             std::pair<double, double>
             bootstrap_p_value(const unsigned & datasets);
@@ -396,6 +426,31 @@ namespace eos
              * @note: all observables are recalculated
              */
             double operator()() const;
+
+            /*!
+             * Evaluate the log likelihood and its gradient with respect to the predictions of all observables.
+             * @note: all observables are recalculated
+             *
+             * @param gradient Set to d log(L) / d prediction, indexed by ObservableCache::Id.
+             *                 All elements are zero if the log likelihood is not finite.
+             *
+             * @return The log likelihood as returned by operator(), i.e., -infinity if it is not finite.
+             */
+            double evaluate_with_gradient(std::vector<double> & gradient) const;
+
+            /*!
+             * Evaluate the log likelihood and its gradient with respect to a set of parameters.
+             *
+             * The gradient with respect to the predictions is exact. It is contracted with the
+             * derivatives of the predictions along each parameter, which are obtained numerically
+             * through derivative<1u, deriv::TwoSided>. Only the observables that depend on the
+             * varied parameter are recalculated. The parameters are restored afterwards.
+             *
+             * @param parameters The parameters with respect to which the gradient is computed.
+             * @param gradient   Set to d log(L) / d parameter, in the order of parameters.
+             *                   All elements are zero if the log likelihood is not finite.
+             */
+            double evaluate_with_gradient(const std::vector<Parameter> & parameters, std::vector<double> & gradient) const;
             ///@}
     };
 
@@ -0,0 +1,91 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/constraint.hh>
+#include <eos/statistics/log-likelihood.hh>
+#include <eos/utils/observable_cache.hh>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/*
+ * Time the evaluation of all multivariate Gaussian constraints with 20 to 60 observables,
+ * most of which constrain form factors, excluding the evaluation of the observables.
+ *
+ * Build with 'make log-likelihood_BENCHMARK' and run without arguments.
+ */
+
+using namespace eos;
+
+int main(int, char **)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static const unsigned evaluations = 100000;
+
+    Parameters p = Parameters::Defaults();
+
+    std::cout << "# constraint, dimension, log(likelihood), wall time per evaluation" << std::endl;
+
+    for (const auto & entry : Constraints())
+    {
+        const std::string name = entry.first.str();
+
+        try
+        {
+            Constraint constraint = Constraint::make(entry.first, Options());
+
+            for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
+            {
+                if (0 != (**b).as_string().find("Multivariate Gaussian"))
+                    continue;
+
+                ObservableCache cache(p);
+                LogLikelihoodBlockPtr block = (**b).clone(cache);
+
+                const unsigned dim = cache.size();
+                if ((dim < 20) || (dim > 60))
+                    continue;
+
+                cache.update();
+
+                double result = 0.0;
+                auto start = Clock::now();
+                for (unsigned i = 0 ; i < evaluations ; ++i)
+                {
+                    result += block->evaluate();
+                }
+                auto stop = Clock::now();
+
+                std::cout << std::setw(60) << std::left << name << std::right
+                          << std::setw(6) << dim
+                          << std::setw(18) << std::setprecision(10) << result / evaluations << std::setprecision(6)
+                          << std::setw(12) << std::chrono::duration<double, std::nano>(stop - start).count() / evaluations << " ns" << std::endl;
+            }
+        }
+        catch (Exception & e)
+        {
+            std::cerr << name << ": skipped, " << e.what() << std::endl;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
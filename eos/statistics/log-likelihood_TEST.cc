@@ -22,7 +22,10 @@
 #include <eos/statistics/log-likelihood.hh>
 #include <eos/statistics/log-posterior_TEST.hh>
 #include <eos/utils/power_of.hh>
+#include <eos/utils/thread_pool.hh>
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 using namespace test;
 using namespace eos;
@@ -163,6 +166,72 @@ namespace eos
                     // check observations
                     TEST_CHECK_EQUAL(3, llh.number_of_observations());
                 }
+
+                // evaluation of mixed block types agrees with the sum over all blocks
+                {
+                    LogLikelihood llh(p);
+                    llh.add(ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k)), +4.1,  +4.2, +4.3);
+
+                    auto cache = llh.observable_cache();
+                    auto obs_c = ObservablePtr(new ObservableStub(p, "mass::c", k));
+                    auto obs_e = ObservablePtr(new ObservableStub(p, "mass::e", k));
+                    auto obs_mu = ObservablePtr(new ObservableStub(p, "mass::mu", k));
+                    std::array<ObservablePtr, 2> obs_mvg{{ obs_c, obs_mu }};
+                    std::array<double, 2> mean_mvg{{ 1.2, 0.1 }};
+                    std::array<std::array<double, 2>, 2> covariance_mvg{{ {{ 0.01, 0.0001 }}, {{ 0.0001, 0.0004 }} }};
+
+                    llh.add(Constraint("test::log-gamma", std::vector<ObservablePtr>{ obs_e },
+                        std::vector<LogLikelihoodBlockPtr>{ LogLikelihoodBlock::LogGamma(cache, obs_e, 0.1, 0.11, 0.13, 0.338082, -0.00649023) }));
+                    llh.add(Constraint("test::amoroso", std::vector<ObservablePtr>{ obs_c },
+                        std::vector<LogLikelihoodBlockPtr>{ LogLikelihoodBlock::Amoroso(cache, obs_c, 0.0, 0.5, 2.0, 3.0) }));
+                    llh.add(Constraint("test::multivariate-gaussian", std::vector<ObservablePtr>{ obs_c, obs_mu },
+                        std::vector<LogLikelihoodBlockPtr>{ LogLikelihoodBlock::MultivariateGaussian<2>(cache, obs_mvg, mean_mvg, covariance_mvg) }));
+
+                    p["mass::b(MSbar)"] = 4.25;
+                    p["mass::c"]        = 1.3;
+                    p["mass::e"]        = 0.115;
+                    p["mass::mu"]       = 0.105;
+
+                    const double result = llh();
+
+                    double expected = 0.0;
+                    for (auto c = llh.begin(), c_end = llh.end() ; c != c_end ; ++c)
+                    {
+                        for (auto b = c->begin_blocks(), b_end = c->end_blocks() ; b != b_end ; ++b)
+                        {
+                            expected += (**b).evaluate();
+                        }
+                    }
+                    TEST_CHECK(std::isfinite(result));
+                    TEST_CHECK_RELATIVE_ERROR(expected, result, 1e-14);
+
+                    // gradient agrees with the numerical derivatives of the likelihood
+                    std::vector<Parameter> gradient_parameters{ p["mass::b(MSbar)"], p["mass::c"], p["mass::e"], p["mass::mu"] };
+                    std::vector<double> gradient;
+                    TEST_CHECK_RELATIVE_ERROR(result, llh.evaluate_with_gradient(gradient_parameters, gradient), 1e-14);
+                    TEST_CHECK_EQUAL(4, gradient.size());
+                    TEST_CHECK_EQUAL(1.3, p["mass::c"].evaluate());
+
+                    for (auto k = 0u ; k < gradient_parameters.size() ; ++k)
+                    {
+                        Parameter & q = gradient_parameters[k];
+                        const double x0 = q.evaluate(), h = 1e-6;
+
+                        q = x0 + h;
+                        const double upper = llh();
+                        q = x0 - h;
+                        const double lower = llh();
+                        q = x0;
+
+                        TEST_CHECK_RELATIVE_ERROR((upper - lower) / (2.0 * h), gradient[k], 1e-6);
+                    }
+
+                    // a single block outside its support renders the likelihood zero
+                    p["mass::c"] = -1.0;
+                    TEST_CHECK_EQUAL(-std::numeric_limits<double>::infinity(), llh());
+
+                    p["mass::c"] = 1.3;
+                }
                 // multiple instances of same observable, to mimic results from different experiments
                 {
                     LogLikelihood llh(p);
@@ -605,6 +674,28 @@ namespace eos
                     auto mvg_correlation = LogLikelihoodBlock::MultivariateGaussian(cache, obs, mean, variances, correlation);
                     auto mvg_covariance = LogLikelihoodBlock::MultivariateGaussian(cache, obs, mean, covariance);
                     TEST_CHECK_RELATIVE_ERROR(mvg_covariance->evaluate(), mvg_correlation->evaluate(), eps);
+
+                    /* high dimension, beyond the stack storage of the block */
+                    // 35 independent copies of the correlated 2-dim Gaussian
+                    std::array<ObservablePtr, 70> obs_70;
+                    std::array<double, 70> mean_70;
+                    std::array<std::array<double, 70>, 70> covariance_70;
+                    for (unsigned i = 0 ; i < 70 ; ++i)
+                    {
+                        obs_70[i] = obs[i % 2];
+                        mean_70[i] = mean[i % 2];
+                        covariance_70[i].fill(0.0);
+                    }
+                    for (unsigned i = 0 ; i < 70 ; i += 2)
+                    {
+                        covariance_70[i][i]         = covariance[0][0];
+                        covariance_70[i + 1][i + 1] = covariance[1][1];
+                        covariance_70[i][i + 1]     = covariance[0][1];
+                        covariance_70[i + 1][i]     = covariance[1][0];
+                    }
+
+                    auto mvg_70 = LogLikelihoodBlock::MultivariateGaussian<70>(cache, obs_70, mean_70, covariance_70);
+                    TEST_CHECK_RELATIVE_ERROR(35.0 * mvg_covariance->evaluate(), mvg_70->evaluate(), 1e-12);
                 }
 
                 // bootstrap p-value calculation
@@ -622,6 +713,20 @@ namespace eos
                     // since data restricted to three sigma around central value,
                     // p-value should be slightly biased upwards
                     TEST_CHECK_NEARLY_EQUAL(p_value, 0.852143788, 5e-3);
+
+                    // simulated data sets are reproducible, regardless of the number of threads
+                    const unsigned number_of_threads = ThreadPool::instance()->number_of_threads();
+
+                    ThreadPool::instance()->resize(1);
+                    const double p_value_1 = llh.bootstrap_p_value(5e4).first;
+
+                    ThreadPool::instance()->resize(4);
+                    const double p_value_4 = llh.bootstrap_p_value(5e4).first;
+
+                    ThreadPool::instance()->resize(number_of_threads);
+
+                    TEST_CHECK_EQUAL(p_value, p_value_1);
+                    TEST_CHECK_EQUAL(p_value_1, p_value_4);
                 }
 
                 // mixture density
@@ -653,6 +758,38 @@ namespace eos
 
                     // ratio of pdfs at mode given by weight ratio
                     TEST_CHECK_RELATIVE_ERROR(pdf_favored, pdf_suppressed + std::log(weights[0] / weights[1]), 1e-12);
+
+                    /* test sampling */
+                    gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
+                    gsl_rng_set(rng, 1243);
+
+                    // well separated components, so that the mean is
+                    // sum_k w_k log(w_k) + log(1 / sqrt(2 pi)) - 1/2
+                    double mean = 0.0;
+                    unsigned n = 1e5;
+                    for (unsigned i = 0 ; i < n ; ++i)
+                    {
+                        mean += m->sample(rng);
+                    }
+                    mean /= n;
+
+                    TEST_CHECK_NEARLY_EQUAL(-1.744022, mean, 1e-2);
+
+                    // unnormalized weights enter the samples as they enter evaluate()
+                    auto m2 = LogLikelihoodBlock::Mixture(components, std::vector<double>{ 2.0 * weights[0], 2.0 * weights[1] });
+                    gsl_rng_set(rng, 1243);
+
+                    double mean2 = 0.0;
+                    for (unsigned i = 0 ; i < n ; ++i)
+                    {
+                        mean2 += m2->sample(rng);
+                    }
+                    mean2 /= n;
+
+                    TEST_CHECK_RELATIVE_ERROR(mean + std::log(2.0), mean2, 1e-12);
+                    TEST_CHECK_RELATIVE_ERROR(pdf_favored + std::log(2.0), m2->evaluate(), 1e-12);
+
+                    gsl_rng_free(rng);
                 }
             }
     } log_likelihood_test;
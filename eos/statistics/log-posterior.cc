@@ -22,8 +22,15 @@
 #include <eos/statistics/log-posterior.hh>
 #include <eos/utils/density-impl.hh>
 #include <eos/utils/hdf5.hh>
+#include <eos/utils/lock.hh>
 #include <eos/utils/log.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/power_of.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <exception>
+#include <limits>
 
 #include <gsl/gsl_cdf.h>
 
@@ -38,11 +45,63 @@ namespace eos
         }
     };
 
+    struct LogPosterior::BatchClones
+    {
+        struct Clone
+        {
+            LogPosteriorPtr log_posterior;
+
+            // generation of the original's parameters at the time the clone was last synchronised
+            Parameters::Generation generation;
+        };
+
+        Mutex mutex;
+
+        // clones that are not in use by any call to evaluate_batch
+        std::vector<Clone> idle;
+
+        // structure of the original at the time the idle clones were created
+        std::size_t number_of_priors = 0;
+        unsigned number_of_observations = 0;
+    };
+
     LogPosterior::LogPosterior(const LogLikelihood & log_likelihood) :
         _log_likelihood(log_likelihood),
         _parameters(log_likelihood.parameters()),
-        _informative_priors(0)
+        _informative_priors(0),
+        _batch_clones(new BatchClones)
+    {
+    }
+
+    LogPosterior::LogPosterior(const LogPosterior & other) :
+        Density(other),
+        _log_likelihood(other._log_likelihood),
+        _parameters(other._parameters),
+        _priors(other._priors),
+        _informative_priors(other._informative_priors),
+        _parameter_descriptions(other._parameter_descriptions),
+        _parameter_ids(other._parameter_ids),
+        _parameter_names(other._parameter_names),
+        _batch_clones(new BatchClones)
+    {
+    }
+
+    LogPosterior &
+    LogPosterior::operator= (const LogPosterior & other)
     {
+        if (this == &other)
+            return *this;
+
+        _log_likelihood = other._log_likelihood;
+        _parameters = other._parameters;
+        _priors = other._priors;
+        _informative_priors = other._informative_priors;
+        _parameter_descriptions = other._parameter_descriptions;
+        _parameter_ids = other._parameter_ids;
+        _parameter_names = other._parameter_names;
+        _batch_clones.reset(new BatchClones);
+
+        return *this;
     }
 
     LogPosterior::~LogPosterior()
@@ -66,6 +125,7 @@ namespace eos
 
            d->nuisance = nuisance;
            _parameter_descriptions.push_back(*d);
+           _parameter_ids.push_back(_parameters[d->parameter->name()].id());
        }
 
        // then add to prior container
@@ -117,6 +177,131 @@ namespace eos
        return log_posterior();
    }
 
+   void
+   LogPosterior::evaluate_batch(const double * points, const std::size_t & n, double * out) const
+   {
+       if (0 == n)
+           return;
+
+       using Clone = BatchClones::Clone;
+
+       const std::size_t dim = _parameter_descriptions.size();
+       const std::size_t number_of_chunks = std::max<std::size_t>(1, std::min<std::size_t>(n, ThreadPool::instance()->number_of_threads()));
+       const unsigned number_of_observations = _log_likelihood.number_of_observations();
+       const Parameters::Generation generation = _parameters.generation();
+
+       // take one idle clone per chunk; concurrent calls create additional clones
+       std::vector<Clone> clones;
+       {
+           Lock l(_batch_clones->mutex);
+           auto & idle = _batch_clones->idle;
+
+           // discard clones that no longer reflect the structure of this posterior
+           if ((_batch_clones->number_of_priors != _priors.size()) || (_batch_clones->number_of_observations != number_of_observations))
+           {
+               idle.clear();
+               _batch_clones->number_of_priors = _priors.size();
+               _batch_clones->number_of_observations = number_of_observations;
+           }
+
+           while ((clones.size() < number_of_chunks) && (! idle.empty()))
+           {
+               clones.push_back(std::move(idle.back()));
+               idle.pop_back();
+           }
+
+           // new clones inherit the present parameter values
+           while (clones.size() < number_of_chunks)
+           {
+               clones.push_back(Clone{ old_clone(), generation });
+           }
+       }
+
+       // synchronise all parameters of outdated clones with the original
+       std::vector<Parameter::Id> ids;
+       std::vector<double> values;
+       for (auto & clone : clones)
+       {
+           if (clone.generation == generation)
+               continue;
+
+           if (ids.empty())
+           {
+               for (const auto & p : _parameters)
+               {
+                   ids.push_back(p.id());
+                   values.push_back(p.evaluate());
+               }
+           }
+
+           clone.log_posterior->_parameters.set_many(ids, values);
+           clone.generation = generation;
+       }
+
+       std::vector<std::exception_ptr> exceptions(number_of_chunks);
+       std::vector<Ticket> tickets;
+       tickets.reserve(number_of_chunks);
+
+       const std::size_t chunk_size = (n + number_of_chunks - 1) / number_of_chunks;
+       for (std::size_t c = 0 ; c < number_of_chunks ; ++c)
+       {
+           const std::size_t begin = c * chunk_size, end = std::min(n, begin + chunk_size);
+           LogPosterior * clone = clones[c].log_posterior.get();
+           std::exception_ptr * exception = &exceptions[c];
+
+           tickets.push_back(ThreadPool::instance()->enqueue([clone, points, out, begin, end, dim, exception]()
+           {
+               try
+               {
+                   std::vector<double> point(dim);
+                   for (std::size_t i = begin ; i < end ; ++i)
+                   {
+                       std::copy(points + i * dim, points + (i + 1) * dim, point.begin());
+
+                       // a point that cannot be evaluated has vanishing posterior density
+                       try
+                       {
+                           clone->set_point(point);
+                           out[i] = clone->evaluate();
+                       }
+                       catch (...)
+                       {
+                           out[i] = -std::numeric_limits<double>::infinity();
+                       }
+                   }
+               }
+               catch (...)
+               {
+                   *exception = std::current_exception();
+               }
+           }));
+       }
+
+       for (auto & t : tickets)
+       {
+           t.wait();
+       }
+
+       // return the clones for later calls; only the varied parameters differ from the original
+       {
+           Lock l(_batch_clones->mutex);
+
+           if ((_batch_clones->number_of_priors == _priors.size()) && (_batch_clones->number_of_observations == number_of_observations))
+           {
+               for (auto & clone : clones)
+               {
+                   _batch_clones->idle.push_back(std::move(clone));
+               }
+           }
+       }
+
+       for (auto & e : exceptions)
+       {
+           if (e)
+               std::rethrow_exception(e);
+       }
+   }
+
    Density::Iterator
    LogPosterior::begin() const
    {
@@ -129,6 +314,12 @@ namespace eos
        return Density::Iterator(_parameter_descriptions.cend());
    }
 
+   void
+   LogPosterior::set_point(const std::vector<double> & point)
+   {
+       _parameters.set_many(_parameter_ids, point);
+   }
+
    void
    LogPosterior::dump_descriptions(hdf5::File & file, const std::string & data_set_base) const
    {
@@ -494,10 +685,12 @@ namespace eos
    {
        // set all components of parameters
        LogPosterior * log_posterior = static_cast<LogPosterior *>(data);
-       for (unsigned i = 0 ; i < log_posterior->_parameter_descriptions.size() ; ++i)
+       std::vector<double> point(log_posterior->_parameter_descriptions.size());
+       for (unsigned i = 0 ; i < point.size() ; ++i)
        {
-           log_posterior->_parameter_descriptions[i].parameter->set(gsl_vector_get(pars, i));
+           point[i] = gsl_vector_get(pars, i);
        }
+       log_posterior->set_point(point);
 
        // calculate negative posterior
        return -(log_posterior->log_prior() + log_posterior->log_likelihood()());
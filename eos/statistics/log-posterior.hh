@@ -30,6 +30,7 @@
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/verify.hh>
 
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -61,6 +62,12 @@ namespace eos
              */
             LogPosterior(const LogLikelihood & log_likelihood);
 
+            /// Copy constructor. The copy does not share the clones used by evaluate_batch.
+            LogPosterior(const LogPosterior & other);
+
+            /// Copy assignment. The clones used by evaluate_batch are discarded.
+            LogPosterior & operator= (const LogPosterior & other);
+
             /// Destructor.
             virtual ~LogPosterior();
 
@@ -72,8 +79,30 @@ namespace eos
 
             virtual double evaluate() const;
 
+            /*!
+             * Evaluate the log(posterior) for a batch of parameter points in parallel.
+             *
+             * The points are distributed over the workers of the ThreadPool. Each worker
+             * evaluates its share of points on its own clone of this LogPosterior. The clones
+             * are kept between calls and are synchronised with the present parameter values
+             * whenever these change. The parameter values of this LogPosterior are not changed.
+             * Concurrent calls are safe; they use separate sets of clones.
+             *
+             * If the evaluation of a point fails with an exception, its log(posterior) is set
+             * to -infinity and the remaining points are evaluated as usual.
+             *
+             * @param points Pointer to n * d values in row-major order, where d is the number of
+             *               parameters and the elements of each point follow the order of iteration.
+             * @param n      The number of points.
+             * @param out    Pointer to n values that receive the log(posterior) of each point.
+             */
+            void evaluate_batch(const double * points, const std::size_t & n, double * out) const;
+
             virtual Iterator begin() const;
             virtual Iterator end() const;
+
+            /// Set all parameters in one batch, advancing the parameters' generation only once.
+            virtual void set_point(const std::vector<double> & point);
             ///@}
 
             ///@name Accessors
@@ -230,8 +259,15 @@ namespace eos
             /// Parameter, minimum, maximum, nuisance
             std::vector<ParameterDescription> _parameter_descriptions;
 
+            /// ids of all parameters within _parameters, in the same order as _parameter_descriptions
+            std::vector<Parameter::Id> _parameter_ids;
+
             /// names of all parameters. prevent using a parameter twice
             std::set<std::string> _parameter_names;
+
+            /// per-worker clones for evaluate_batch, owned by this object alone
+            struct BatchClones;
+            std::shared_ptr<BatchClones> _batch_clones;
     };
 
      // todo move optimization into separate class
@@ -22,9 +22,52 @@
 
 #include <eos/statistics/log-posterior_TEST.hh>
 
+#include <limits>
+
 using namespace test;
 using namespace eos;
 
+namespace
+{
+    // Stub observable whose evaluation fails for parameter values beyond a threshold.
+    class FailingObservableStub :
+        public ObservableStub
+    {
+        private:
+            Parameters _parameters;
+
+            double _threshold;
+
+        public:
+            FailingObservableStub(const Parameters & parameters, const QualifiedName & name, const double & threshold) :
+                ObservableStub(parameters, name),
+                _parameters(parameters),
+                _threshold(threshold)
+            {
+            }
+
+            virtual double evaluate() const
+            {
+                const double value = ObservableStub::evaluate();
+
+                if (value > _threshold)
+                    throw InternalError("FailingObservableStub: value beyond threshold");
+
+                return value;
+            }
+
+            virtual ObservablePtr clone() const
+            {
+                return ObservablePtr(new FailingObservableStub(_parameters.clone(), name(), _threshold));
+            }
+
+            virtual ObservablePtr clone(const Parameters & parameters) const
+            {
+                return ObservablePtr(new FailingObservableStub(parameters, name(), _threshold));
+            }
+    };
+}
+
 class LogPosteriorTest :
     public TestCase
 {
@@ -144,6 +187,114 @@ class LogPosteriorTest :
                 TEST_CHECK_THROWS(InternalError, log_posterior.log_prior());
             }
 
+            // batch evaluation
+            {
+                LogPosterior log_posterior = make_log_posterior(false);
+                MutablePtr p = log_posterior[0];
+                const double initial = p->evaluate();
+
+                const std::vector<double> points{ 4.0, 4.1, 4.2, 4.3, 4.4, 4.5, 4.6 };
+                std::vector<double> results(points.size());
+                log_posterior.evaluate_batch(points.data(), points.size(), results.data());
+
+                // the original's parameters remain unchanged
+                TEST_CHECK_EQUAL(p->evaluate(), initial);
+
+                for (unsigned i = 0 ; i < points.size() ; ++i)
+                {
+                    p->set(points[i]);
+                    TEST_CHECK_RELATIVE_ERROR(results[i], log_posterior.evaluate(), eps);
+                }
+
+            }
+
+            // batch evaluation follows changes of parameters that are not varied
+            {
+                Parameters parameters = Parameters::Defaults();
+
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), 4.1, 4.2, 4.3);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")),        1.15, 1.2, 1.25);
+
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::b(MSbar)", ParameterRange{ 3.7, 4.9 }));
+
+                const std::vector<double> points{ 4.1, 4.2, 4.3 };
+                std::vector<double> results(points.size());
+
+                for (double m_c : { 1.2, 1.25 })
+                {
+                    parameters["mass::c"] = m_c;
+                    log_posterior.evaluate_batch(points.data(), points.size(), results.data());
+
+                    for (unsigned i = 0 ; i < points.size() ; ++i)
+                    {
+                        parameters["mass::b(MSbar)"] = points[i];
+                        TEST_CHECK_RELATIVE_ERROR(results[i], log_posterior.evaluate(), eps);
+                    }
+                }
+            }
+
+            // batch evaluation yields -inf for points that cannot be evaluated
+            {
+                Parameters parameters = Parameters::Defaults();
+
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new FailingObservableStub(parameters, "mass::b(MSbar)", 4.35)), 4.1, 4.2, 4.3);
+
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::b(MSbar)", ParameterRange{ 3.7, 4.9 }));
+
+                const std::vector<double> points{ 4.1, 4.4, 4.2, 4.5, 4.3 };
+                std::vector<double> results(points.size());
+                log_posterior.evaluate_batch(points.data(), points.size(), results.data());
+
+                for (unsigned i = 0 ; i < points.size() ; ++i)
+                {
+                    if (points[i] > 4.35)
+                    {
+                        TEST_CHECK_EQUAL(-std::numeric_limits<double>::infinity(), results[i]);
+                        continue;
+                    }
+
+                    parameters["mass::b(MSbar)"] = points[i];
+                    TEST_CHECK_RELATIVE_ERROR(results[i], log_posterior.evaluate(), eps);
+                }
+            }
+
+            // copies do not share their clones for batch evaluation
+            {
+                Parameters parameters = Parameters::Defaults();
+
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), 4.1, 4.2, 4.3);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")),        1.15, 1.2, 1.25);
+
+                // same number of priors, but for different parameters
+                LogPosterior log_posterior(llh);
+                LogPosterior copy(log_posterior);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::b(MSbar)", ParameterRange{ 3.7, 4.9 }));
+                copy.add(LogPrior::Flat(parameters, "mass::c", ParameterRange{ 1.0, 1.5 }));
+
+                const std::vector<double> points_b{ 4.1, 4.2, 4.3 }, points_c{ 1.15, 1.2, 1.25 };
+                std::vector<double> results_b(3), results_c(3);
+                log_posterior.evaluate_batch(points_b.data(), points_b.size(), results_b.data());
+                copy.evaluate_batch(points_c.data(), points_c.size(), results_c.data());
+
+                for (unsigned i = 0 ; i < 3 ; ++i)
+                {
+                    parameters["mass::b(MSbar)"] = points_b[i];
+                    TEST_CHECK_RELATIVE_ERROR(results_b[i], log_posterior.evaluate(), eps);
+                }
+                parameters["mass::b(MSbar)"] = parameters["mass::b(MSbar)"].central();
+
+                for (unsigned i = 0 ; i < 3 ; ++i)
+                {
+                    parameters["mass::c"] = points_c[i];
+                    TEST_CHECK_RELATIVE_ERROR(results_c[i], copy.evaluate(), eps);
+                }
+            }
+
             // 1D optimization
             {
                 LogPosterior log_posterior = make_log_posterior(false);
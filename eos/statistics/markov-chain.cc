@@ -181,11 +181,8 @@ namespace eos
                             + ". Check if thread safety is violated due to incorrect ParameterDescription cloning");
             }
 #endif
-            // change Parameter object
-            for (unsigned i = 0 ; i < parameter_descriptions.size() ; ++i)
-            {
-                parameter_descriptions[i].parameter->set(proposal.point[i]);
-            }
+            // change Parameter objects in one batch
+            density->set_point(proposal.point);
 
             // finally evaluate the target density
             proposal.log_density = density->evaluate();
@@ -377,10 +374,7 @@ namespace eos
         // undo changes to Parameter object
         inline void revert()
         {
-            for (unsigned i = 0 ; i < parameter_descriptions.size() ; ++i)
-            {
-                parameter_descriptions[i].parameter->set(current.point[i]);
-            }
+            density->set_point(current.point);
         }
 
         // set the number of iterations for next run and go
@@ -293,6 +293,29 @@ class CacheableObservableTest :
             // Test cache evaluation
             TEST_CHECK_NO_THROW(cache.update());
             TEST_CHECK_EQUAL(cache[cacheable_observable_id],  cache[cacheable_observable2_id]);
+            TEST_CHECK_NEARLY_EQUAL(cache[regular_observable_id], 5.27934 - 2.0 * 2.0, 1.e-5);
+
+            // Test cache evaluation after changing an unused parameter
+            p["mass::c"] = 1.5;
+            TEST_CHECK_NO_THROW(cache.update());
+            TEST_CHECK_NEARLY_EQUAL(cache[cacheable_observable_id],  5.27934 - 2.0 * 2.0, 1.e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[cacheable_observable2_id], 5.27934 - 2.0 * 2.0, 1.e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[cacheable_observable3_id], 36.0,                1.e-5);
+
+            // Test cache evaluation after changing a used parameter
+            p["mass::B_u"] = 5.0;
+            TEST_CHECK_NO_THROW(cache.update());
+            TEST_CHECK_NEARLY_EQUAL(cache[cacheable_observable_id],  5.0 - 2.0 * 2.0, 1.e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[cacheable_observable2_id], 5.0 - 2.0 * 2.0, 1.e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[cacheable_observable3_id], 36.0,            1.e-5);
+
+            // Test cache evaluation after changing a kinematic variable
+            regular_observable->kinematics().set("q2", 3.0);
+            cacheable_observable3->kinematics().set("q2", 5.0);
+            TEST_CHECK_NO_THROW(cache.update());
+            TEST_CHECK_NEARLY_EQUAL(cache[cacheable_observable_id],  5.0 - 2.0 * 2.0, 1.e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[regular_observable_id],    5.27934 - 2.0 * 3.0, 1.e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[cacheable_observable3_id], 25.0,            1.e-5);
 
             // Test cache cloning
             ObservableCache cache2(p);
@@ -49,6 +49,17 @@ namespace eos
         }
     }
 
+    void
+    Density::set_point(const std::vector<double> & point)
+    {
+        auto x = point.cbegin();
+        for (auto & d : *this)
+        {
+            d.parameter->set(*x);
+            ++x;
+        }
+    }
+
     Density::Output::DescriptionType
     Density::Output::description_type()
     {
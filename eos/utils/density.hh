@@ -27,6 +27,8 @@
 #include <eos/utils/parameters.hh> // todo move ParameterDescription elsewhere and remove include
 #include <eos/utils/wrapped_forward_iterator.hh>
 
+#include <vector>
+
 namespace eos
 {
     /*!
@@ -55,6 +57,13 @@ namespace eos
             virtual Iterator end() const = 0;
             ///@}
 
+            /*!
+             * Set the numeric values of all parameters relevant to this density function.
+             *
+             * @param point The new parameter point, with one value per parameter in the order of iteration.
+             */
+            virtual void set_point(const std::vector<double> & point);
+
             /*!
              * Write parameter descriptions into the hdf5 file under the given data set name.
              */
@@ -1173,3 +1173,312 @@ int hcubature(unsigned fdim, integrand f, void *fdata,
 }
 
 /***************************************************************************/
+
+/***************************************************************************/
+/* p-adaptive cubature, using tensor products of nested Clenshaw-Curtis
+   rules.  The rule in dimension i has level L[i]: level 0 is the midpoint
+   rule, and level L > 0 uses the 2^L + 1 points cos(pi j / 2^L).  Since
+   the rules are nested, doubling the degree in dimension i reuses all
+   previous function values and only evaluates the new points.
+
+   The error in dimension i is estimated by comparing with the rule of
+   the next-lower level in that dimension; the dimension with the largest
+   error estimate is refined until convergence, until maxEval would be
+   exceeded, or until the maximal level is reached.  The degrees are given
+   as m[i] = L[i] - 1, i.e. m[i] = 0 is the 3-point rule, as in the
+   original pcubature interface. */
+
+#define MAXLEVEL 20 /* at most 2^20 + 1 points per dimension */
+
+/* Clenshaw-Curtis weights on [-1,1] for level L > 0, for the points
+   cos(pi j / n), j = 0, ..., n with n = 2^L */
+static void clencurt_weights(unsigned L, double *w)
+{
+    size_t n = ((size_t) 1) << L, j, k;
+    for (j = 0; j <= n; ++j) {
+        double s = 0;
+        for (k = 1; k <= n / 2; ++k) {
+            double b = (2 * k == n) ? 1.0 : 2.0;
+            s += b / (4.0 * k * k - 1.0) * cos(2.0 * k * j * M_PI / n);
+        }
+        w[j] = ((j == 0 || j == n) ? 1.0 : 2.0) / n * (1.0 - s);
+    }
+}
+
+/* weights of the level-L rule, and of the level-(L-1) rule embedded
+   into the points of the level-L rule (zero on the new points) */
+static void level_weights(unsigned L, double *w, double *wlow)
+{
+    size_t n = ((size_t) 1) << L, j;
+    clencurt_weights(L, w);
+    if (L == 1) {
+        wlow[0] = 0; wlow[1] = 2.0; wlow[2] = 0;
+        return;
+    }
+    clencurt_weights(L - 1, wlow);
+    for (j = n / 2; j > 0; --j) {
+        wlow[2 * j] = wlow[j];
+        wlow[2 * j - 1] = 0;
+    }
+}
+
+typedef struct {
+    unsigned dim, fdim;
+    integrand_v f;
+    void *fdata;
+    const double *c, *h; /* center and half-widths */
+    double **buf;
+    size_t *nbuf, max_nbuf;
+    size_t *idx; /* pending flat indices into vals */
+    size_t npending;
+    double *vals;
+    size_t numEval;
+} pgrid;
+
+/* evaluate all pending points of the grid with sizes n[] */
+static int pgrid_flush(pgrid *g, const size_t *n)
+{
+    unsigned d;
+    size_t p, q;
+    double *fval;
+    if (g->npending == 0) return SUCCESS;
+    if (*g->nbuf < g->npending * (g->dim + g->fdim)) {
+        double *b = (double *) realloc(*g->buf, sizeof(double) * g->npending * (g->dim + g->fdim));
+        if (!b) return FAILURE;
+        *g->buf = b;
+        *g->nbuf = g->npending * (g->dim + g->fdim);
+    }
+    for (p = 0; p < g->npending; ++p) {
+        size_t i = g->idx[p];
+        for (d = g->dim; d-- > 0;) {
+            size_t k = i % n[d];
+            i /= n[d];
+            (*g->buf)[p * g->dim + d] = g->c[d]
+                + g->h[d] * (n[d] == 1 ? 0.0 : cos(k * M_PI / (n[d] - 1)));
+        }
+    }
+    fval = *g->buf + g->npending * g->dim;
+    if (g->f(g->dim, g->npending, *g->buf, g->fdata, g->fdim, fval))
+        return FAILURE;
+    for (p = 0; p < g->npending; ++p)
+        for (q = 0; q < g->fdim; ++q)
+            g->vals[g->idx[p] * g->fdim + q] = fval[p * g->fdim + q];
+    g->numEval += g->npending;
+    g->npending = 0;
+    return SUCCESS;
+}
+
+static int pgrid_push(pgrid *g, const size_t *n, size_t i)
+{
+    g->idx[g->npending++] = i;
+    if (g->npending == g->max_nbuf) return pgrid_flush(g, n);
+    return SUCCESS;
+}
+
+/* val[k] = sum over the grid of prod_d w_d(k_d) f_k, where the weights
+   in dimension lowdim (if < dim) are taken from wlow */
+static void pgrid_rule(const pgrid *g, const size_t *n, size_t N,
+                       double *const *w, const double *wlow, unsigned lowdim,
+                       double *val)
+{
+    size_t i, k;
+    unsigned d;
+    for (k = 0; k < g->fdim; ++k) val[k] = 0;
+    for (i = 0; i < N; ++i) {
+        size_t r = i;
+        double weight = 1;
+        for (d = g->dim; d-- > 0;) {
+            size_t kd = r % n[d];
+            r /= n[d];
+            weight *= (d == lowdim) ? wlow[kd] : w[d][kd];
+        }
+        if (weight == 0) continue;
+        for (k = 0; k < g->fdim; ++k) val[k] += weight * g->vals[i * g->fdim + k];
+    }
+}
+
+int pcubature_v_buf(unsigned fdim, integrand_v f, void *fdata,
+                    unsigned dim, const double *xmin, const double *xmax,
+                    size_t maxEval,
+                    double reqAbsError, double reqRelError,
+                    error_norm norm,
+                    unsigned *m,
+                    double **buf, size_t *nbuf, size_t max_nbuf,
+                    double *val, double *err)
+{
+    int status = FAILURE;
+    unsigned d, i, k;
+    size_t N, j;
+    double vol = 1;
+    double *c = NULL, *h = NULL, *tmp = NULL, *errs = NULL;
+    double **w = NULL, **wlow = NULL;
+    size_t *n = NULL, *nold = NULL;
+    unsigned *L = NULL;
+    esterr *ee = NULL;
+    pgrid g;
+
+    g.vals = NULL; g.idx = NULL;
+
+    if (fdim == 0) return SUCCESS; /* nothing to do */
+    if (dim == 0) { /* trivial integration */
+        if (f(0, 1, xmin, fdata, fdim, val)) return FAILURE;
+        for (k = 0; k < fdim; ++k) err[k] = 0;
+        return SUCCESS;
+    }
+    if (fdim <= 1) norm = ERROR_INDIVIDUAL; /* norm is irrelevant */
+    if (norm < 0 || norm > ERROR_LINF) return FAILURE; /* invalid norm */
+    if (max_nbuf < 1) max_nbuf = 1;
+
+    c = (double *) malloc(sizeof(double) * dim * 2);
+    n = (size_t *) malloc(sizeof(size_t) * dim * 2);
+    L = (unsigned *) malloc(sizeof(unsigned) * dim);
+    w = (double **) calloc(dim * 2, sizeof(double *));
+    tmp = (double *) malloc(sizeof(double) * fdim * 2);
+    errs = (double *) malloc(sizeof(double) * fdim * dim);
+    ee = (esterr *) malloc(sizeof(esterr) * fdim);
+    g.idx = (size_t *) malloc(sizeof(size_t) * max_nbuf);
+    if (!c || !n || !L || !w || !tmp || !errs || !ee || !g.idx) goto done;
+    h = c + dim; nold = n + dim; wlow = w + dim;
+
+    for (d = 0; d < dim; ++d) {
+        c[d] = 0.5 * (xmax[d] + xmin[d]);
+        h[d] = 0.5 * (xmax[d] - xmin[d]);
+        vol *= h[d];
+        L[d] = (m && m[d] + 1 <= MAXLEVEL) ? m[d] + 1 : 1;
+    }
+
+    g.dim = dim; g.fdim = fdim; g.f = f; g.fdata = fdata; g.c = c; g.h = h;
+    g.buf = buf; g.nbuf = nbuf; g.max_nbuf = max_nbuf;
+    g.npending = 0; g.numEval = 0;
+
+    /* initial grid */
+    for (N = 1, d = 0; d < dim; ++d) {
+        n[d] = (((size_t) 1) << L[d]) + 1;
+        N *= n[d];
+    }
+    g.vals = (double *) malloc(sizeof(double) * N * fdim);
+    if (!g.vals) goto done;
+    for (j = 0; j < N; ++j)
+        if (pgrid_push(&g, n, j)) goto done;
+    if (pgrid_flush(&g, n)) goto done;
+
+    for (;;) {
+        double maxerr = -1;
+        unsigned imax = 0;
+        size_t Nnew, stride;
+        double *vals;
+
+        for (d = 0; d < dim; ++d) {
+            free(w[d]);
+            w[d] = (double *) malloc(sizeof(double) * 2 * n[d]);
+            if (!w[d]) goto done;
+            wlow[d] = w[d] + n[d];
+            level_weights(L[d], w[d], wlow[d]);
+        }
+
+        pgrid_rule(&g, n, N, w, NULL, dim, tmp);
+        for (k = 0; k < fdim; ++k) {
+            ee[k].val = vol * tmp[k];
+            ee[k].err = 0;
+        }
+        for (d = 0; d < dim; ++d) {
+            double e = 0;
+            pgrid_rule(&g, n, N, w, wlow[d], d, tmp + fdim);
+            for (k = 0; k < fdim; ++k) {
+                errs[d * fdim + k] = fabs(vol * (tmp[k] - tmp[fdim + k]));
+                if (errs[d * fdim + k] > ee[k].err) ee[k].err = errs[d * fdim + k];
+                if (errs[d * fdim + k] > e) e = errs[d * fdim + k];
+            }
+            if (L[d] < MAXLEVEL && e > maxerr) {
+                maxerr = e;
+                imax = d;
+            }
+        }
+
+        if (converged(fdim, ee, reqAbsError, reqRelError, norm) || maxerr < 0)
+            break;
+
+        /* refine dimension imax */
+        i = imax;
+        Nnew = N / n[i] * (2 * n[i] - 1);
+        if (maxEval && g.numEval + (Nnew - N) > maxEval)
+            break;
+        vals = (double *) malloc(sizeof(double) * Nnew * fdim);
+        if (!vals) goto done;
+        for (d = 0; d < dim; ++d) nold[d] = n[d];
+        n[i] = 2 * n[i] - 1;
+        ++L[i];
+        for (j = 0; j < N; ++j) { /* copy the old points */
+            size_t r = j, jnew = 0, stride = 1;
+            for (d = dim; d-- > 0;) {
+                size_t kd = r % nold[d];
+                r /= nold[d];
+                jnew += stride * ((d == i) ? 2 * kd : kd);
+                stride *= n[d];
+            }
+            memcpy(vals + jnew * fdim, g.vals + j * fdim, sizeof(double) * fdim);
+        }
+        free(g.vals);
+        g.vals = vals;
+        N = Nnew;
+        for (stride = 1, d = i + 1; d < dim; ++d) stride *= n[d];
+        for (j = 0; j < N; ++j) /* evaluate the new points */
+            if ((j / stride) % n[i] % 2 == 1)
+                if (pgrid_push(&g, n, j)) goto done;
+        if (pgrid_flush(&g, n)) goto done;
+    }
+
+    for (k = 0; k < fdim; ++k) {
+        val[k] = ee[k].val;
+        err[k] = ee[k].err;
+    }
+    if (m)
+        for (d = 0; d < dim; ++d) m[d] = L[d] - 1;
+    status = SUCCESS;
+
+done:
+    if (status != SUCCESS)
+        for (k = 0; k < fdim; ++k) {
+            val[k] = 0;
+            err[k] = HUGE_VAL;
+        }
+    if (w)
+        for (d = 0; d < dim; ++d) free(w[d]);
+    free(w); free(g.vals); free(g.idx);
+    free(ee); free(errs); free(tmp); free(L); free(n); free(c);
+    return status;
+}
+
+#define DEFAULT_MAX_NBUF (1U << 20)
+
+int pcubature_v(unsigned fdim, integrand_v f, void *fdata,
+                unsigned dim, const double *xmin, const double *xmax,
+                size_t maxEval, double reqAbsError, double reqRelError,
+                error_norm norm,
+                double *val, double *err)
+{
+    int ret;
+    size_t nbuf = 0;
+    double *buf = NULL;
+
+    ret = pcubature_v_buf(fdim, f, fdata, dim, xmin, xmax,
+                          maxEval, reqAbsError, reqRelError, norm,
+                          NULL, &buf, &nbuf, DEFAULT_MAX_NBUF, val, err);
+    free(buf);
+    return ret;
+}
+
+int pcubature(unsigned fdim, integrand f, void *fdata,
+              unsigned dim, const double *xmin, const double *xmax,
+              size_t maxEval, double reqAbsError, double reqRelError,
+              error_norm norm,
+              double *val, double *err)
+{
+    fv_data d;
+
+    if (fdim == 0) return SUCCESS; /* nothing to do */
+
+    d.f = f; d.fdata = fdata;
+    return pcubature_v(fdim, fv, &d, dim, xmin, xmax,
+                       maxEval, reqAbsError, reqRelError, norm, val, err);
+}
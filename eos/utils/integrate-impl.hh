@@ -26,13 +26,115 @@
 #include <eos/utils/integrate-cubature.hh>
 #include <eos/utils/matrix.hh>
 
+#include <algorithm>
 #include <cassert>
+#include <type_traits>
 #include <vector>
 
 namespace eos
 {
-    template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b)
+    namespace implementation
     {
+        /*
+         * Evaluate f on the n + 1 equidistant points a + i * h, i = 0, ..., n.
+         */
+        template <typename T_>
+        void sample(const std::function<T_ (const double &)> & f, std::vector<T_> & y, const unsigned & n, const double & a, const double & h)
+        {
+            y.clear();
+            y.reserve(n + 1);
+            for (unsigned i = 0 ; i < n + 1 ; ++i)
+            {
+                y.push_back(f(a + i * h));
+            }
+        }
+
+        /*
+         * Refine the samples y of f from n to 2 * n intervals with step width h = (b - a) / (2 * n).
+         *
+         * The previous samples become the even-indexed samples, and f is evaluated only
+         * at the n new odd-indexed midpoints.
+         */
+        template <typename T_>
+        void refine(const std::function<T_ (const double &)> & f, std::vector<T_> & y, const unsigned & n, const double & a, const double & h)
+        {
+            y.resize(2 * n + 1);
+
+            // spread the previous samples, starting at the end to avoid overwriting
+            for (unsigned i = n ; i > 0 ; --i)
+            {
+                y[2 * i] = y[i];
+            }
+
+            for (unsigned i = 0 ; i < n ; ++i)
+            {
+                y[2 * i + 1] = f(a + (2 * i + 1) * h);
+            }
+        }
+
+        /*
+         * Integrand with k real-valued components, writing f_0(x), ..., f_{k - 1}(x) to y.
+         */
+        using fdd_components = std::function<void (const double & x, double * y)>;
+
+        /*
+         * Integrate the k components of f on [a, b] with shared sampling points, and write the
+         * results to result[0], ..., result[k - 1].
+         *
+         * The components are partitioned into consecutive groups of group_size components each.
+         * The tolerance applies to the Euclidean norm of each group, e.g., to the modulus of a
+         * complex number stored as its real and imaginary parts.
+         */
+        template <typename Method_>
+        void integrate_components(const fdd_components & f, const std::size_t & k, const std::size_t & group_size,
+                const double & a, const double & b, const typename Method_::Config & config, double * result,
+                const IntegrationSite & site);
+    }
+
+    template <typename Method_, std::size_t k_>
+    std::array<double, k_> integrate(const std::function<std::array<double, k_> (const double &)> & f,
+                     const double &a, const double &b,
+                     const typename Method_::Config &config,
+                     const IntegrationSite & site)
+    {
+        const implementation::fdd_components g = [&f] (const double & x, double * y)
+        {
+            const std::array<double, k_> v = f(x);
+            std::copy(v.begin(), v.end(), y);
+        };
+
+        std::array<double, k_> result;
+        implementation::integrate_components<Method_>(g, k_, 1, a, b, config, result.data(), site);
+
+        return result;
+    }
+
+    template <typename Method_, typename T_>
+    complex<T_> integrate(const std::function<complex<T_> (const double &)> & f,
+                     const double &a, const double &b,
+                     const typename Method_::Config &config,
+                     const IntegrationSite & site)
+    {
+        static_assert(std::is_same<T_, double>::value, "only complex<double> integrands are supported");
+
+        const implementation::fdd_components g = [&f] (const double & x, double * y)
+        {
+            const complex<double> v = f(x);
+            y[0] = v.real();
+            y[1] = v.imag();
+        };
+
+        double result[2];
+        implementation::integrate_components<Method_>(g, 2, 2, a, b, config, result, site);
+
+        return complex<double>(result[0], result[1]);
+    }
+
+    template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b,
+            unsigned * evaluations, const IntegrationSite & site)
+    {
+        IntegrationStatistics::Record record(site, "integrate1D");
+
         if (n & 0x1)
             n += 1;
 
@@ -44,82 +146,105 @@ namespace eos
 
         // evaluate function for every sampling point
         std::vector<std::array<double, k>> y;
-        for (unsigned i = 0 ; i < n + 1 ; ++i)
-        {
-            y.push_back(f(a + i * h));
-        }
+        implementation::sample(f, y, n, a, h);
+        unsigned calls = n + 1;
 
-        std::array<double, k> Q0; Q0.fill(0.0);
-        std::array<double, k> Q1; Q1.fill(0.0);
-        std::array<double, k> Q2; Q2.fill(0.0);
+        std::array<double, k> result;
 
-        for (unsigned i = 0 ; i < n / 8 ; ++i)
-        {
-            Q0 = Q0 + y[8 * i] + 4.0 * y[8 * i + 4] + y[8 * i + 4];
-        }
-        for (unsigned i = 0 ; i < n / 4 ; ++i)
-        {
-            Q1 = Q1 + y[4 * i] + 4.0 * y[4 * i + 2] + y[4 * i + 4];
-        }
-        for (unsigned i = 0 ; i < n / 2 ; ++i)
+        while (true)
         {
-            Q2 = Q2 + y[2 * i] + 4.0 * y[2 * i + 1] + y[2 * i + 2];
-        }
-
-        Q0 = (h / 3.0 * 4.0) * Q0;
-        Q1 = (h / 3.0 * 2.0) * Q1;
-        Q2 = (h / 3.0) * Q2;
+            std::array<double, k> Q0; Q0.fill(0.0);
+            std::array<double, k> Q1; Q1.fill(0.0);
+            std::array<double, k> Q2; Q2.fill(0.0);
 
-        std::array<double, k> denom = Q0 + Q2 - 2.0 * Q1;
-        std::array<double, k> num = Q2 - Q1;
-        std::array<double, k> correction = divide(mult(num, num), denom);
-
-        bool correction_valid = true;
-        for (unsigned i = 0 ; i < k ; ++i)
-        {
-            if (std::isnan(correction[i]))
+            for (unsigned i = 0 ; i < n / 8 ; ++i)
             {
-                correction_valid = false;
-                break;
+                Q0 = Q0 + y[8 * i] + 4.0 * y[8 * i + 4] + y[8 * i + 4];
+            }
+            for (unsigned i = 0 ; i < n / 4 ; ++i)
+            {
+                Q1 = Q1 + y[4 * i] + 4.0 * y[4 * i + 2] + y[4 * i + 4];
+            }
+            for (unsigned i = 0 ; i < n / 2 ; ++i)
+            {
+                Q2 = Q2 + y[2 * i] + 4.0 * y[2 * i + 1] + y[2 * i + 2];
             }
-        }
 
-        if (!correction_valid)
-        {
-            return Q2;
-        }
-        else
-        {
-            bool correction_small = true;
+            Q0 = (h / 3.0 * 4.0) * Q0;
+            Q1 = (h / 3.0 * 2.0) * Q1;
+            Q2 = (h / 3.0) * Q2;
+
+            std::array<double, k> denom = Q0 + Q2 - 2.0 * Q1;
+            std::array<double, k> num = Q2 - Q1;
+            std::array<double, k> correction = divide(mult(num, num), denom);
 
+            bool correction_valid = true;
             for (unsigned i = 0 ; i < k ; ++i)
             {
-                if ((abs(correction[i] / Q2[i])) > 1.0)
+                if (std::isnan(correction[i]))
                 {
-                    correction_small = false;
+                    correction_valid = false;
                     break;
                 }
             }
 
-            if (correction_small)
+            if (!correction_valid)
             {
-                return Q2 - correction;
+                result = Q2;
+                break;
             }
             else
             {
+                bool correction_small = true;
+
+                for (unsigned i = 0 ; i < k ; ++i)
+                {
+                    if ((abs(correction[i] / Q2[i])) > 1.0)
+                    {
+                        correction_small = false;
+                        break;
+                    }
+                }
+
+                if (correction_small)
+                {
+                    result = Q2 - correction;
+                    break;
+                }
+                else
+                {
 #if 0
-                std::cerr << "Q0 = " << Q0 << std::endl;
-                std::cerr << "Q1 = " << Q1 << std::endl;
-                std::cerr << "Q2 = " << Q2 << std::endl;
-                std::cerr << "Reintegrating with twice the number of data points" << std::endl;
+                    std::cerr << "Q0 = " << Q0 << std::endl;
+                    std::cerr << "Q1 = " << Q1 << std::endl;
+                    std::cerr << "Q2 = " << Q2 << std::endl;
+                    std::cerr << "Reintegrating with twice the number of data points" << std::endl;
 #endif
-                return integrate1D(f, 2 * n, a, b);
+                    // reintegrate with twice the number of data points, reusing the previous ones
+                    h = (b - a) / (2 * n);
+                    implementation::refine(f, y, n, a, h);
+                    calls += n;
+                    n *= 2;
+                }
             }
         }
+
+        record.evaluations(calls);
+        record.subdivisions(n);
+
+        if (evaluations)
+            *evaluations = calls;
+
+        return result;
     }
 
     namespace cubature
     {
+        /*
+         * Integrate the vectorised integrand f of dim variables on the box [a, b] with the
+         * randomly shifted lattice rule, cf. Backend::lattice.
+         */
+        double lattice(const std::function<void (const double *, double *, const std::size_t &)> & f, const unsigned & dim,
+                const double * a, const double * b, const Config & config, const IntegrationSite & site);
 
         template <size_t dim_>
         int scalar_integrand(unsigned ndim , const double *x, void *data,
@@ -137,24 +262,130 @@ namespace eos
             return 0;
         }
 
+        template <size_t dim_>
+        int vectorised_integrand(unsigned ndim, size_t npt, const double *x, void *data,
+                      unsigned fdim, double *fval)
+        {
+            assert(ndim == dim_);
+            assert(fdim == 1);
+
+            auto& f = *static_cast<cubature::fdd_v<dim_> *>(data);
+            f(x, fval, npt);
+
+            return 0;
+        }
+
+        template <size_t dim_, size_t k_>
+        int components_integrand(unsigned ndim, const double *x, void *data,
+                      unsigned fdim, double *fval)
+        {
+            assert(ndim == dim_);
+            assert(fdim == k_);
+
+            auto& f = *static_cast<std::function<std::array<double, k_> (const std::array<double, dim_> &)> *>(data);
+            std::array<double, dim_> args;
+            std::copy(x, x + dim_, args.data());
+            const std::array<double, k_> values = f(args);
+            std::copy(values.begin(), values.end(), fval);
+
+            return 0;
+        }
     }
 
     template <size_t dim_>
     double integrate(const cubature::fdd<dim_> & f,
                      const std::array<double, dim_> &a,
                      const std::array<double, dim_> &b,
-                     const cubature::Config &config)
+                     const cubature::Config &config,
+                     const IntegrationSite & site)
     {
+        if (cubature::Backend::lattice == config.backend())
+        {
+            const auto f_v = [&f] (const double * x, double * y, const std::size_t & n)
+            {
+                std::array<double, dim_> args;
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    std::copy(x + i * dim_, x + (i + 1) * dim_, args.data());
+                    y[i] = f(args);
+                }
+            };
+
+            return cubature::lattice(f_v, dim_, a.data(), b.data(), config, site);
+        }
+
+        const char * method = cubature::method(config.backend());
+        const auto routine = (cubature::Backend::pcubature == config.backend()) ? &::pcubature : &::hcubature;
+        IntegrationStatistics::Record record(site, method);
+
         // TODO Support infinite intervals by param trafo? Not for now.
         constexpr unsigned nintegrands = 1;
         double res;
         double err;
-        if (hcubature(nintegrands, &cubature::scalar_integrand<dim_>,
-                      &const_cast<cubature::fdd<dim_>&>(f), dim_, a.data(), b.data(),
-                      config.maxeval(), config.epsabs(), config.epsrel(), ERROR_L2, &res, &err))
+        if (routine(nintegrands, &cubature::scalar_integrand<dim_>,
+                    &const_cast<cubature::fdd<dim_>&>(record.count(f)), dim_, a.data(), b.data(),
+                    config.maxeval(), config.epsabs(), config.epsrel(), ERROR_L2, &res, &err))
+        {
+            throw IntegrationError(std::string(method) + " failed");
+        }
+        record.error(err);
+
+        return res;
+    }
+
+    template <size_t dim_>
+    double integrate(const cubature::fdd_v<dim_> & f,
+                     const std::array<double, dim_> &a,
+                     const std::array<double, dim_> &b,
+                     const cubature::Config &config,
+                     const IntegrationSite & site)
+    {
+        if (cubature::Backend::lattice == config.backend())
+            return cubature::lattice(f, dim_, a.data(), b.data(), config, site);
+
+        const char * method = cubature::method(config.backend());
+        const auto routine = (cubature::Backend::pcubature == config.backend()) ? &::pcubature_v : &::hcubature_v;
+        IntegrationStatistics::Record record(site, method);
+
+        constexpr unsigned nintegrands = 1;
+        double res;
+        double err;
+        if (routine(nintegrands, &cubature::vectorised_integrand<dim_>,
+                    &const_cast<cubature::fdd_v<dim_>&>(record.count(f)), dim_, a.data(), b.data(),
+                    config.maxeval(), config.epsabs(), config.epsrel(), ERROR_L2, &res, &err))
+        {
+            throw IntegrationError(std::string(method) + "_v failed");
+        }
+        record.error(err);
+
+        return res;
+    }
+
+    template <size_t dim_, size_t k_>
+    std::array<double, k_> integrate(const std::function<std::array<double, k_> (const std::array<double, dim_> &)> & f,
+                     const std::array<double, dim_> &a,
+                     const std::array<double, dim_> &b,
+                     const cubature::Config &config,
+                     const IntegrationSite & site)
+    {
+        using Integrand = std::function<std::array<double, k_> (const std::array<double, dim_> &)>;
+
+        if (cubature::Backend::lattice == config.backend())
+            throw IntegrationError("vector-valued integrands are not supported by the lattice backend");
+
+        const char * method = cubature::method(config.backend());
+        const auto routine = (cubature::Backend::pcubature == config.backend()) ? &::pcubature : &::hcubature;
+        IntegrationStatistics::Record record(site, method);
+
+        std::array<double, k_> res;
+        std::array<double, k_> err;
+        if (routine(k_, &cubature::components_integrand<dim_, k_>,
+                    &const_cast<Integrand &>(record.count(f)), dim_, a.data(), b.data(),
+                    config.maxeval(), config.epsabs(), config.epsrel(), ERROR_INDIVIDUAL, res.data(), err.data()))
         {
-            throw IntegrationError("hcubature failed");
+            throw IntegrationError(std::string(method) + " failed");
         }
+        record.error(*std::max_element(err.begin(), err.end()));
 
         return res;
     }
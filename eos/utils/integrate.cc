@@ -19,11 +19,17 @@
  */
 
 #include <eos/utils/integrate.hh>
+#include <eos/utils/integrate-impl.hh>
 #include <eos/utils/matrix.hh>
 
 #include <gsl/gsl_errno.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <limits>
+#include <memory>
+#include <random>
 #include <vector>
 
 namespace
@@ -33,6 +39,448 @@ namespace
         const auto& f = *static_cast<eos::GSL::fdd*>(params);
         return f(x);
     }
+
+    /*
+     * Per-thread stack of QAGS workspaces.
+     *
+     * Each integration leases the workspace at the current depth of the stack for its
+     * duration, so that nested integrations on the same thread never share a workspace.
+     */
+    class WorkspaceLease
+    {
+        private:
+            struct Stack
+            {
+                std::vector<std::unique_ptr<eos::GSL::QAGS::Workspace>> workspaces;
+
+                std::size_t depth = 0;
+            };
+
+            static Stack & stack()
+            {
+                static thread_local Stack stack;
+
+                return stack;
+            }
+
+            eos::GSL::QAGS::Workspace * _workspace;
+
+        public:
+            WorkspaceLease()
+            {
+                Stack & s = stack();
+
+                if (s.workspaces.size() == s.depth)
+                {
+                    s.workspaces.emplace_back(new eos::GSL::QAGS::Workspace());
+                }
+
+                _workspace = s.workspaces[s.depth].get();
+                ++s.depth;
+            }
+
+            ~WorkspaceLease()
+            {
+                --stack().depth;
+            }
+
+            WorkspaceLease(const WorkspaceLease &) = delete;
+            WorkspaceLease & operator= (const WorkspaceLease &) = delete;
+
+            eos::GSL::QAGS::Workspace & operator* () const
+            {
+                return *_workspace;
+            }
+    };
+
+    /*
+     * Gauss-Kronrod rules, with the same nodes and weights as in QUADPACK's qk15, qk21, qk31 and qk41.
+     *
+     * Rule<n_> is the (2 n_ + 1)-point Kronrod extension of the n_-point Gauss-Legendre rule. The
+     * non-negative abscissae of the Kronrod rule are given in descending order; the ones with odd
+     * indices are also abscissae of the Gauss rule.
+     */
+    namespace gauss_kronrod
+    {
+        template <unsigned n_> struct Rule;
+
+        template <> struct Rule<7>
+        {
+            static constexpr double xgk[8] =
+            {
+                0.991455371120812639206854697526329,
+                0.949107912342758524526189684047851,
+                0.864864423359769072789712788640926,
+                0.741531185599394439863864773280788,
+                0.586087235467691130294144838258730,
+                0.405845151377397166906606412076961,
+                0.207784955007898467600689403773245,
+                0.000000000000000000000000000000000
+            };
+
+            static constexpr double wgk[8] =
+            {
+                0.022935322010529224963732008058970,
+                0.063092092629978553290700663189204,
+                0.104790010322250183839876322541518,
+                0.140653259715525918745189590510238,
+                0.169004726639267902826583426598550,
+                0.190350578064785409913256402421014,
+                0.204432940075298892414161999234649,
+                0.209482141084727828012999174891714
+            };
+
+            static constexpr double wg[4] =
+            {
+                0.129484966168869693270611432679082,
+                0.279705391489276667901467771423780,
+                0.381830050505118944950369775488975,
+                0.417959183673469387755102040816327
+            };
+        };
+        constexpr double Rule<7>::xgk[];
+        constexpr double Rule<7>::wgk[];
+        constexpr double Rule<7>::wg[];
+
+        template <> struct Rule<10>
+        {
+            static constexpr double xgk[11] =
+            {
+                0.995657163025808080735527280689003,
+                0.973906528517171720077964012084452,
+                0.930157491355708226001207180059508,
+                0.865063366688984510732096688423493,
+                0.780817726586416897063717578345042,
+                0.679409568299024406234327365114874,
+                0.562757134668604683339000099272694,
+                0.433395394129247190799265943165784,
+                0.294392862701460198131126603103866,
+                0.148874338981631210884826001129720,
+                0.000000000000000000000000000000000
+            };
+
+            static constexpr double wgk[11] =
+            {
+                0.011694638867371874278064396062192,
+                0.032558162307964727478818972459390,
+                0.054755896574351996031381300244580,
+                0.075039674810919952767043140916190,
+                0.093125454583697605535065465083366,
+                0.109387158802297641899210590325805,
+                0.123491976262065851077958109831074,
+                0.134709217311473325928054001771707,
+                0.142775938577060080797094273138717,
+                0.147739104901338491374841515972068,
+                0.149445554002916905664936468389821
+            };
+
+            static constexpr double wg[5] =
+            {
+                0.066671344308688137593568809893332,
+                0.149451349150580593145776339657697,
+                0.219086362515982043995534934228163,
+                0.269266719309996355091226921569469,
+                0.295524224714752870173892994651338
+            };
+        };
+        constexpr double Rule<10>::xgk[];
+        constexpr double Rule<10>::wgk[];
+        constexpr double Rule<10>::wg[];
+
+        template <> struct Rule<15>
+        {
+            static constexpr double xgk[16] =
+            {
+                0.998002298693397060285172840152271,
+                0.987992518020485428489565718586613,
+                0.967739075679139134257347978784337,
+                0.937273392400705904307758947710209,
+                0.897264532344081900882509656454496,
+                0.848206583410427216200648320774217,
+                0.790418501442465932967649294817947,
+                0.724417731360170047416186054613938,
+                0.650996741297416970533735895313275,
+                0.570972172608538847537226737253911,
+                0.485081863640239680693655740232351,
+                0.394151347077563369897207370981045,
+                0.299180007153168812166780024266389,
+                0.201194093997434522300628303394596,
+                0.101142066918717499027074231447392,
+                0.000000000000000000000000000000000
+            };
+
+            static constexpr double wgk[16] =
+            {
+                0.005377479872923348987792051430128,
+                0.015007947329316122538374763075807,
+                0.025460847326715320186874001019653,
+                0.035346360791375846222037948478360,
+                0.044589751324764876608227299373280,
+                0.053481524690928087265343147239430,
+                0.062009567800670640285139230960803,
+                0.069854121318728258709520077099147,
+                0.076849680757720378894432777482659,
+                0.083080502823133021038289247286104,
+                0.088564443056211770647275443693774,
+                0.093126598170825321225486872747346,
+                0.096642726983623678505179907627589,
+                0.099173598721791959332393173484603,
+                0.100769845523875595044946662617570,
+                0.101330007014791549017374792767493
+            };
+
+            static constexpr double wg[8] =
+            {
+                0.030753241996117268354628393577204,
+                0.070366047488108124709267416450667,
+                0.107159220467171935011869546685869,
+                0.139570677926154314447804794511028,
+                0.166269205816993933553200860481209,
+                0.186161000015562211026800561866423,
+                0.198431485327111576456118326443839,
+                0.202578241925561272880620199967519
+            };
+        };
+        constexpr double Rule<15>::xgk[];
+        constexpr double Rule<15>::wgk[];
+        constexpr double Rule<15>::wg[];
+
+        template <> struct Rule<20>
+        {
+            static constexpr double xgk[21] =
+            {
+                0.998859031588277663838315576545863,
+                0.993128599185094924786122388471320,
+                0.981507877450250259193342994720217,
+                0.963971927277913791267666131197277,
+                0.940822633831754753519982722212443,
+                0.912234428251325905867752441203298,
+                0.878276811252281976077442995113078,
+                0.839116971822218823394529061701521,
+                0.795041428837551198350638833272788,
+                0.746331906460150792614305070355642,
+                0.693237656334751384805490711845932,
+                0.636053680726515025452836696226286,
+                0.575140446819710315342946036586425,
+                0.510867001950827098004364050955251,
+                0.443593175238725103199992213492640,
+                0.373706088715419560672548177024927,
+                0.301627868114913004320555356858592,
+                0.227785851141645078080496195368575,
+                0.152605465240922675505220241022678,
+                0.076526521133497333754640409398838,
+                0.000000000000000000000000000000000
+            };
+
+            static constexpr double wgk[21] =
+            {
+                0.003073583718520531501218293246031,
+                0.008600269855642942198661787950102,
+                0.014626169256971252983787960308868,
+                0.020388373461266523598010231432755,
+                0.025882133604951158834505067096153,
+                0.031287306777032798958543119323801,
+                0.036600169758200798030557240707211,
+                0.041668873327973686263788305936895,
+                0.046434821867497674720231880926108,
+                0.050944573923728691932707670050345,
+                0.055195105348285994744832372419777,
+                0.059111400880639572374967220648594,
+                0.062653237554781168025870122174255,
+                0.065834597133618422111563556969398,
+                0.068648672928521619345623411885368,
+                0.071054423553444068305790361723210,
+                0.073030690332786667495189417658913,
+                0.074582875400499188986581418362488,
+                0.075704497684556674659542775376617,
+                0.076377867672080736705502835038061,
+                0.076600711917999656445049901530102
+            };
+
+            static constexpr double wg[10] =
+            {
+                0.017614007139152118311861962351853,
+                0.040601429800386941331039952274932,
+                0.062672048334109063569506535187042,
+                0.083276741576704748724758143222046,
+                0.101930119817240435036750135480350,
+                0.118194531961518417312377377711382,
+                0.131688638449176626898494499748163,
+                0.142096109318382051329298325067165,
+                0.149172986472603746787828737001969,
+                0.152753387130725850698084331955098
+            };
+        };
+        constexpr double Rule<20>::xgk[];
+        constexpr double Rule<20>::wgk[];
+        constexpr double Rule<20>::wg[];
+
+        // write the 2 n_ + 1 abscissae of the rule on [a, b] to x, starting with the center
+        template <unsigned n_>
+        void abscissae(const double & a, const double & b, double * x)
+        {
+            const double center = 0.5 * (a + b), half_length = 0.5 * (b - a);
+
+            x[0] = center;
+            for (unsigned j = 0 ; j < n_ ; ++j)
+            {
+                x[2 * j + 1] = center - half_length * Rule<n_>::xgk[j];
+                x[2 * j + 2] = center + half_length * Rule<n_>::xgk[j];
+            }
+        }
+
+        struct Result
+        {
+            double value;
+            double error;
+        };
+
+        // apply the rule on [a, b] to the integrand values y at the abscissae above
+        template <unsigned n_>
+        Result apply(const double & a, const double & b, const double * y)
+        {
+            using R = Rule<n_>;
+
+            const double half_length = 0.5 * (b - a), abs_half_length = std::abs(half_length);
+
+            // for odd n_, the center is also an abscissa of the Gauss rule
+            double result_gauss = (n_ & 0x1) ? y[0] * R::wg[n_ / 2] : 0.0;
+            double result_kronrod = y[0] * R::wgk[n_];
+            double result_abs = std::abs(result_kronrod);
+
+            for (unsigned j = 0 ; j < n_ ; ++j)
+            {
+                const double sum = y[2 * j + 1] + y[2 * j + 2];
+
+                if (j & 0x1)
+                    result_gauss += R::wg[j / 2] * sum;
+
+                result_kronrod += R::wgk[j] * sum;
+                result_abs += R::wgk[j] * (std::abs(y[2 * j + 1]) + std::abs(y[2 * j + 2]));
+            }
+
+            const double mean = 0.5 * result_kronrod;
+            double result_asc = R::wgk[n_] * std::abs(y[0] - mean);
+            for (unsigned j = 0 ; j < n_ ; ++j)
+            {
+                result_asc += R::wgk[j] * (std::abs(y[2 * j + 1] - mean) + std::abs(y[2 * j + 2] - mean));
+            }
+
+            result_abs *= abs_half_length;
+            result_asc *= abs_half_length;
+
+            // rescale the error estimate as in QUADPACK
+            double error = std::abs((result_kronrod - result_gauss) * half_length);
+            if ((0.0 != result_asc) && (0.0 != error))
+            {
+                const double scale = std::pow(200.0 * error / result_asc, 1.5);
+                error = (scale < 1.0) ? result_asc * scale : result_asc;
+            }
+
+            if (result_abs > std::numeric_limits<double>::min() / (50.0 * std::numeric_limits<double>::epsilon()))
+            {
+                error = std::max(error, 50.0 * std::numeric_limits<double>::epsilon() * result_abs);
+            }
+
+            return Result{ result_kronrod * half_length, error };
+        }
+
+        template <unsigned n_>
+        double integrate(const eos::GSL::fdd_v & f, const double & a, const double & b, const eos::GSL::QNG::Config & config,
+                const eos::IntegrationSite & site)
+        {
+            eos::IntegrationStatistics::Record record(site, "Gauss");
+
+            std::array<double, 2 * n_ + 1> x, y;
+
+            abscissae<n_>(a, b, x.data());
+            f(x.data(), y.data(), x.size());
+            const Result r = apply<n_>(a, b, y.data());
+
+            record.evaluations(x.size());
+            record.subdivisions(1);
+            record.error(r.error);
+
+            if (r.error > std::max(config.epsabs(), config.epsrel() * std::abs(r.value)))
+                throw eos::IntegrationError(gsl_strerror(GSL_ETOL));
+
+            return r.value;
+        }
+
+        /*
+         * Apply the rule on [a, b] to the k components of y, stored with stride k at each abscissa, and
+         * write the k values and the error estimates of each group of group_size components.
+         *
+         * The error estimate of a group is the Euclidean norm of the error estimates of its components.
+         */
+        template <unsigned n_>
+        void apply_components(const double & a, const double & b, const double * y, const std::size_t & k, const std::size_t & group_size,
+                double * values, double * errors)
+        {
+            std::array<double, 2 * n_ + 1> y_c;
+
+            std::fill(errors, errors + k / group_size, 0.0);
+            for (std::size_t c = 0 ; c < k ; ++c)
+            {
+                for (unsigned i = 0 ; i < 2 * n_ + 1 ; ++i)
+                {
+                    y_c[i] = y[i * k + c];
+                }
+
+                const Result r = apply<n_>(a, b, y_c.data());
+                values[c] = r.value;
+                errors[c / group_size] += r.error * r.error;
+            }
+
+            for (std::size_t g = 0 ; g < k / group_size ; ++g)
+            {
+                errors[g] = std::sqrt(errors[g]);
+            }
+        }
+
+        // Euclidean norms of the groups of group_size components each
+        std::vector<double> group_norms(const double * values, const std::size_t & k, const std::size_t & group_size)
+        {
+            std::vector<double> result(k / group_size, 0.0);
+            for (std::size_t c = 0 ; c < k ; ++c)
+            {
+                result[c / group_size] += values[c] * values[c];
+            }
+
+            for (auto & r : result)
+            {
+                r = std::sqrt(r);
+            }
+
+            return result;
+        }
+
+        // check that the error estimate of each group meets the tolerance
+        bool converged(const double * values, const double * errors, const std::size_t & k, const std::size_t & group_size,
+                const double & epsabs, const double & epsrel)
+        {
+            const std::vector<double> norms = group_norms(values, k, group_size);
+            for (std::size_t g = 0 ; g < norms.size() ; ++g)
+            {
+                if (errors[g] > std::max(epsabs, epsrel * norms[g]))
+                    return false;
+            }
+
+            return true;
+        }
+
+        // evaluate a scalar integrand one abscissa at a time
+        eos::GSL::fdd_v vectorise(const eos::GSL::fdd & f)
+        {
+            return [&f] (const double * x, double * y, const std::size_t & n)
+            {
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    y[i] = f(x[i]);
+                }
+            };
+        }
+    }
 }
 
 namespace eos
@@ -41,8 +489,11 @@ namespace eos
     using std::real;
     using std::imag;
 
-    double integrate1D(const std::function<double (const double &)> & f, unsigned n, const double & a, const double & b)
+    double integrate1D(const GSL::fdd_v & f, unsigned n, const double & a, const double & b,
+            unsigned * evaluations, const IntegrationSite & site)
     {
+        IntegrationStatistics::Record record(site, "integrate1D");
+
         if (n & 0x1)
             n += 1;
 
@@ -50,60 +501,117 @@ namespace eos
             n = 16;
 
         double h = (b - a) / n;
-        std::vector<double> y;
 
+        // evaluate the function for all sampling points in one batch
+        std::vector<double> x(n + 1), y(n + 1);
         for (unsigned k(0) ; k < n + 1 ; ++k)
         {
-            y.push_back(f(a + k * h));
+            x[k] = a + k * h;
         }
+        f(x.data(), y.data(), n + 1);
+        unsigned calls = n + 1;
 
-        double Q0 = 0.0, Q1 = 0.0, Q2 = 0.0;
-        for (unsigned k(0) ; k < n / 8 ; ++k)
-        {
-            Q0 += y[8 * k] + 4.0 * y[8 * k + 4] + y[8 * k + 4];
-        }
-        for (unsigned k(0) ; k < n / 4 ; ++k)
-        {
-            Q1 += y[4 * k] + 4.0 * y[4 * k + 2] + y[4 * k + 4];
-        }
-        for (unsigned k(0) ; k < n / 2 ; ++k)
+        double result;
+
+        while (true)
         {
-            Q2 += y[2 * k] + 4.0 * y[2 * k + 1] + y[2 * k + 2];
-        }
+            double Q0 = 0.0, Q1 = 0.0, Q2 = 0.0;
+            for (unsigned k(0) ; k < n / 8 ; ++k)
+            {
+                Q0 += y[8 * k] + 4.0 * y[8 * k + 4] + y[8 * k + 4];
+            }
+            for (unsigned k(0) ; k < n / 4 ; ++k)
+            {
+                Q1 += y[4 * k] + 4.0 * y[4 * k + 2] + y[4 * k + 4];
+            }
+            for (unsigned k(0) ; k < n / 2 ; ++k)
+            {
+                Q2 += y[2 * k] + 4.0 * y[2 * k + 1] + y[2 * k + 2];
+            }
 
-        Q0 = Q0 * h / 3.0 * 4.0;
-        Q1 = Q1 * h / 3.0 * 2.0;
-        Q2 = Q2 * h / 3.0;
+            Q0 = Q0 * h / 3.0 * 4.0;
+            Q1 = Q1 * h / 3.0 * 2.0;
+            Q2 = Q2 * h / 3.0;
 
-        double denom = (Q0 + Q2 - 2.0 * Q1);
-        double num = Q2 - Q1;
-        double correction = num * num / denom;
-        double result;
+            double denom = (Q0 + Q2 - 2.0 * Q1);
+            double num = Q2 - Q1;
+            double correction = num * num / denom;
 
-        if (std::isnan(correction))
-        {
-            result = Q2;
-        }
-        else if (abs(correction / Q2) < 1.0)
-        {
-            result = Q2 - correction;
-        }
-        else
-        {
+            if (std::isnan(correction))
+            {
+                result = Q2;
+                break;
+            }
+            else if (abs(correction / Q2) < 1.0)
+            {
+                result = Q2 - correction;
+                record.error(abs(correction));
+                break;
+            }
+            else
+            {
 #if 0
-            std::cerr << "Q0 = " << Q0 << std::endl;
-            std::cerr << "Q1 = " << Q1 << std::endl;
-            std::cerr << "Q2 = " << Q2 << std::endl;
-            std::cerr << "Reintegrating with twice the number of data points" << std::endl;
+                std::cerr << "Q0 = " << Q0 << std::endl;
+                std::cerr << "Q1 = " << Q1 << std::endl;
+                std::cerr << "Q2 = " << Q2 << std::endl;
+                std::cerr << "Reintegrating with twice the number of data points" << std::endl;
 #endif
-            result = integrate1D(f, 2 * n, a, b);
+                // reintegrate with twice the number of data points, reusing the previous ones
+                // and evaluating all new midpoints in one batch
+                h = (b - a) / (2 * n);
+                y.resize(2 * n + 1);
+                for (unsigned k(n) ; k > 0 ; --k)
+                {
+                    y[2 * k] = y[k];
+                }
+
+                x.resize(n);
+                for (unsigned k(0) ; k < n ; ++k)
+                {
+                    x[k] = a + (2 * k + 1) * h;
+                }
+
+                std::vector<double> y_new(n);
+                f(x.data(), y_new.data(), n);
+                for (unsigned k(0) ; k < n ; ++k)
+                {
+                    y[2 * k + 1] = y_new[k];
+                }
+
+                calls += n;
+                n *= 2;
+            }
         }
 
+        record.evaluations(calls);
+        record.subdivisions(n);
+
+        if (evaluations)
+            *evaluations = calls;
+
         return result;
     }
 
-    complex<double> integrate1D(const std::function<complex<double> (const double &)> & f, unsigned n, const double & a, const double & b)
+    double integrate1D(const std::function<double (const double &)> & f, unsigned n, const double & a, const double & b,
+            unsigned * evaluations, const IntegrationSite & site)
     {
+        // evaluate the scalar integrand one abscissa at a time
+        const GSL::fdd_v f_v = [&f] (const double * x, double * y, const std::size_t & m)
+        {
+            for (std::size_t k(0) ; k < m ; ++k)
+            {
+                y[k] = f(x[k]);
+            }
+        };
+
+        return integrate1D(f_v, n, a, b, evaluations, site);
+    }
+
+    complex<double> integrate1D(const std::function<complex<double> (const double &)> & f, unsigned n, const double & a, const double & b,
+            unsigned * evaluations, const IntegrationSite & site)
+    {
+        IntegrationStatistics::Record record(site, "integrate1D");
+
         if (n & 0x1)
             n += 1;
 
@@ -112,54 +620,68 @@ namespace eos
 
         double h = (b - a) / n;
         std::vector<complex<double>> y;
+        implementation::sample(f, y, n, a, h);
+        unsigned calls = n + 1;
 
-        for (unsigned k(0) ; k < n + 1 ; ++k)
-        {
-            y.push_back(f(a + k * h));
-        }
+        complex<double> result;
 
-        complex<double> Q0 = 0.0, Q1 = 0.0, Q2 = 0.0;
-        for (unsigned k(0) ; k < n / 8 ; ++k)
+        while (true)
         {
-            Q0 += y[8 * k] + 4.0 * y[8 * k + 4] + y[8 * k + 4];
-        }
-        for (unsigned k(0) ; k < n / 4 ; ++k)
-        {
-            Q1 += y[4 * k] + 4.0 * y[4 * k + 2] + y[4 * k + 4];
-        }
-        for (unsigned k(0) ; k < n / 2 ; ++k)
-        {
-            Q2 += y[2 * k] + 4.0 * y[2 * k + 1] + y[2 * k + 2];
-        }
+            complex<double> Q0 = 0.0, Q1 = 0.0, Q2 = 0.0;
+            for (unsigned k(0) ; k < n / 8 ; ++k)
+            {
+                Q0 += y[8 * k] + 4.0 * y[8 * k + 4] + y[8 * k + 4];
+            }
+            for (unsigned k(0) ; k < n / 4 ; ++k)
+            {
+                Q1 += y[4 * k] + 4.0 * y[4 * k + 2] + y[4 * k + 4];
+            }
+            for (unsigned k(0) ; k < n / 2 ; ++k)
+            {
+                Q2 += y[2 * k] + 4.0 * y[2 * k + 1] + y[2 * k + 2];
+            }
 
-        Q0 = Q0 * h / 3.0 * 4.0;
-        Q1 = Q1 * h / 3.0 * 2.0;
-        Q2 = Q2 * h / 3.0;
+            Q0 = Q0 * h / 3.0 * 4.0;
+            Q1 = Q1 * h / 3.0 * 2.0;
+            Q2 = Q2 * h / 3.0;
 
-        double denom_r = real(Q0 + Q2 - 2.0 * Q1), denom_i = imag(Q0 + Q2 - 2.0 * Q1);
-        double num_r = real(Q2 - Q1), num_i = imag(Q2 - Q1);
-        double correction_r = num_r * num_r / denom_r, correction_i = num_i * num_i / denom_i;
-        complex<double> result;
+            double denom_r = real(Q0 + Q2 - 2.0 * Q1), denom_i = imag(Q0 + Q2 - 2.0 * Q1);
+            double num_r = real(Q2 - Q1), num_i = imag(Q2 - Q1);
+            double correction_r = num_r * num_r / denom_r, correction_i = num_i * num_i / denom_i;
 
-        if (std::isnan(correction_r) || std::isnan(correction_i))
-        {
-            result = Q2;
-        }
-        else if ((abs(correction_r / real(Q2)) < 1.0) && (abs(correction_i / imag(Q2)) < 1.0))
-        {
-            result = Q2 - complex<double>(correction_r, correction_i);
-        }
-        else
-        {
+            if (std::isnan(correction_r) || std::isnan(correction_i))
+            {
+                result = Q2;
+                break;
+            }
+            else if ((abs(correction_r / real(Q2)) < 1.0) && (abs(correction_i / imag(Q2)) < 1.0))
+            {
+                result = Q2 - complex<double>(correction_r, correction_i);
+                record.error(abs(complex<double>(correction_r, correction_i)));
+                break;
+            }
+            else
+            {
 #if 0
-            std::cerr << "Q0 = " << Q0 << std::endl;
-            std::cerr << "Q1 = " << Q1 << std::endl;
-            std::cerr << "Q2 = " << Q2 << std::endl;
-            std::cerr << "Reintegrating with twice the number of data points" << std::endl;
+                std::cerr << "Q0 = " << Q0 << std::endl;
+                std::cerr << "Q1 = " << Q1 << std::endl;
+                std::cerr << "Q2 = " << Q2 << std::endl;
+                std::cerr << "Reintegrating with twice the number of data points" << std::endl;
 #endif
-            result = integrate1D(f, 2 * n, a, b);
+                // reintegrate with twice the number of data points, reusing the previous ones
+                h = (b - a) / (2 * n);
+                implementation::refine(f, y, n, a, h);
+                calls += n;
+                n *= 2;
+            }
         }
 
+        record.evaluations(calls);
+        record.subdivisions(n);
+
+        if (evaluations)
+            *evaluations = calls;
+
         return result;
     }
 
@@ -244,8 +766,11 @@ namespace eos
     }
 
     template <>
-    double integrate<GSL::QNG>(const GSL::fdd &f, const double &a, const double &b, const GSL::QNG::Config &config)
+    double integrate<GSL::QNG>(const GSL::fdd &f, const double &a, const double &b, const GSL::QNG::Config &config,
+            const IntegrationSite & site)
     {
+        IntegrationStatistics::Record record(site, "QNG");
+
         double result, abserr;
         size_t neval;
         gsl_function F;
@@ -255,6 +780,10 @@ namespace eos
         auto status = gsl_integration_qng(&F, a, b, config.epsabs(), config.epsrel(),
                                           &result, &abserr, &neval);
 
+        record.evaluations(neval);
+        record.subdivisions(1);
+        record.error(abserr);
+
         if (status)
         {
             throw IntegrationError(gsl_strerror(status));
@@ -263,18 +792,26 @@ namespace eos
     }
 
     template <>
-    double integrate<GSL::QAGS>(const GSL::fdd &f, const double &a, const double &b, const GSL::QAGS::Config &config)
+    double integrate<GSL::QAGS>(const GSL::fdd &f, const double &a, const double &b, const GSL::QAGS::Config &config,
+            const IntegrationSite & site)
     {
+        IntegrationStatistics::Record record(site, "QAGS");
+
         double result, abserr;
         gsl_function F;
         F.function = &gsl_function_adapter;
-        F.params = (void*)&f;
+        F.params = (void*)&record.count(f);
+
+        WorkspaceLease work_space;
 
         auto status = gsl_integration_qag(&F, a, b, config.epsabs(), config.epsrel(),
-                                          GSL::work_space.limit(), config.key(),
-                                          GSL::work_space,
+                                          (*work_space).limit(), config.key(),
+                                          *work_space,
                                           &result, &abserr);
 
+        record.subdivisions(static_cast<gsl_integration_workspace *>(*work_space)->size);
+        record.error(abserr);
+
         if (status)
         {
             throw IntegrationError(gsl_strerror(status));
@@ -282,11 +819,384 @@ namespace eos
         return result;
     }
 
+    template <>
+    double integrate<Gauss<7>>(const GSL::fdd &f, const double &a, const double &b, const Gauss<7>::Config &config,
+            const IntegrationSite & site)
+    {
+        return gauss_kronrod::integrate<7>(gauss_kronrod::vectorise(f), a, b, config, site);
+    }
+
+    template <>
+    double integrate<Gauss<10>>(const GSL::fdd &f, const double &a, const double &b, const Gauss<10>::Config &config,
+            const IntegrationSite & site)
+    {
+        return gauss_kronrod::integrate<10>(gauss_kronrod::vectorise(f), a, b, config, site);
+    }
+
+    template <>
+    double integrate<Gauss<15>>(const GSL::fdd &f, const double &a, const double &b, const Gauss<15>::Config &config,
+            const IntegrationSite & site)
+    {
+        return gauss_kronrod::integrate<15>(gauss_kronrod::vectorise(f), a, b, config, site);
+    }
+
+    template <>
+    double integrate<Gauss<20>>(const GSL::fdd &f, const double &a, const double &b, const Gauss<20>::Config &config,
+            const IntegrationSite & site)
+    {
+        return gauss_kronrod::integrate<20>(gauss_kronrod::vectorise(f), a, b, config, site);
+    }
+
+    template <>
+    double integrate<Gauss<7>>(const GSL::fdd_v &f, const double &a, const double &b, const Gauss<7>::Config &config,
+            const IntegrationSite & site)
+    {
+        return gauss_kronrod::integrate<7>(f, a, b, config, site);
+    }
+
+    template <>
+    double integrate<Gauss<10>>(const GSL::fdd_v &f, const double &a, const double &b, const Gauss<10>::Config &config,
+            const IntegrationSite & site)
+    {
+        return gauss_kronrod::integrate<10>(f, a, b, config, site);
+    }
+
+    template <>
+    double integrate<Gauss<15>>(const GSL::fdd_v &f, const double &a, const double &b, const Gauss<15>::Config &config,
+            const IntegrationSite & site)
+    {
+        return gauss_kronrod::integrate<15>(f, a, b, config, site);
+    }
+
+    template <>
+    double integrate<Gauss<20>>(const GSL::fdd_v &f, const double &a, const double &b, const Gauss<20>::Config &config,
+            const IntegrationSite & site)
+    {
+        return gauss_kronrod::integrate<20>(f, a, b, config, site);
+    }
+
+    template <>
+    double integrate<GSL::QNG>(const GSL::fdd_v &f, const double &a, const double &b, const GSL::QNG::Config &config,
+            const IntegrationSite & site)
+    {
+        IntegrationStatistics::Record record(site, "QNG");
+
+        std::vector<double> x, y;
+
+        // apply the 21-point rule on 1, 2 and 4 equal subintervals, with one batch of evaluations each
+        for (unsigned m = 1 ; m <= 4 ; m *= 2)
+        {
+            const double h = (b - a) / m;
+
+            x.resize(m * Gauss<10>::points);
+            y.resize(m * Gauss<10>::points);
+            for (unsigned i = 0 ; i < m ; ++i)
+            {
+                gauss_kronrod::abscissae<10>(a + i * h, (i + 1 == m) ? b : a + (i + 1) * h, &x[i * Gauss<10>::points]);
+            }
+
+            f(x.data(), y.data(), x.size());
+
+            double result = 0.0, abserr = 0.0;
+            for (unsigned i = 0 ; i < m ; ++i)
+            {
+                auto r = gauss_kronrod::apply<10>(a + i * h, (i + 1 == m) ? b : a + (i + 1) * h, &y[i * Gauss<10>::points]);
+                result += r.value;
+                abserr += r.error;
+            }
+
+            record.evaluations(2 * m * Gauss<10>::points - Gauss<10>::points);
+            record.subdivisions(m);
+            record.error(abserr);
+
+            if (abserr <= std::max(config.epsabs(), config.epsrel() * std::abs(result)))
+                return result;
+        }
+
+        throw IntegrationError(gsl_strerror(GSL_ETOL));
+    }
+
+    template <>
+    double integrate<GSL::QAGS>(const GSL::fdd_v &f, const double &a, const double &b, const GSL::QAGS::Config &config,
+            const IntegrationSite & site)
+    {
+        IntegrationStatistics::Record record(site, "QAGS");
+
+        if (2 != config.key())
+            throw IntegrationError("vectorised QAGS only supports the 21-point Gauss-Kronrod rule (key = 2)");
+
+        struct Interval
+        {
+            double a, b;
+            gauss_kronrod::Result r;
+
+            bool operator< (const Interval & rhs) const
+            {
+                return r.error < rhs.r.error;
+            }
+        };
+
+        std::vector<double> x(2 * Gauss<10>::points), y(2 * Gauss<10>::points);
+
+        gauss_kronrod::abscissae<10>(a, b, x.data());
+        f(x.data(), y.data(), Gauss<10>::points);
+
+        // max-heap of subintervals, ordered by their error estimates
+        std::vector<Interval> intervals{ Interval{ a, b, gauss_kronrod::apply<10>(a, b, y.data()) } };
+        double result = intervals.front().r.value, abserr = intervals.front().r.error;
+
+        const int limit = GSL::QAGS::Workspace::default_limit;
+        for (int iteration = 1 ; ; ++iteration)
+        {
+            if (abserr <= std::max(config.epsabs(), config.epsrel() * std::abs(result)))
+                break;
+
+            if (iteration >= limit)
+                throw IntegrationError(gsl_strerror(GSL_EMAXITER));
+
+            // bisect the subinterval with the largest error, evaluating both halves in one batch
+            std::pop_heap(intervals.begin(), intervals.end());
+            const Interval worst = intervals.back();
+            intervals.pop_back();
+
+            const double mid = 0.5 * (worst.a + worst.b);
+            if ((mid <= std::min(worst.a, worst.b)) || (mid >= std::max(worst.a, worst.b)))
+                throw IntegrationError(gsl_strerror(GSL_ESING));
+
+            gauss_kronrod::abscissae<10>(worst.a, mid, &x[0]);
+            gauss_kronrod::abscissae<10>(mid, worst.b, &x[Gauss<10>::points]);
+            f(x.data(), y.data(), 2 * Gauss<10>::points);
+
+            const Interval lower{ worst.a, mid, gauss_kronrod::apply<10>(worst.a, mid, &y[0]) };
+            const Interval upper{ mid, worst.b, gauss_kronrod::apply<10>(mid, worst.b, &y[Gauss<10>::points]) };
+
+            result += lower.r.value + upper.r.value - worst.r.value;
+            abserr += lower.r.error + upper.r.error - worst.r.error;
+
+            intervals.push_back(lower);
+            std::push_heap(intervals.begin(), intervals.end());
+            intervals.push_back(upper);
+            std::push_heap(intervals.begin(), intervals.end());
+        }
+
+        // avoid accumulated round-off errors in the running sum
+        result = 0.0;
+        for (const auto & i : intervals)
+        {
+            result += i.r.value;
+        }
+
+        record.evaluations((2 * intervals.size() - 1) * Gauss<10>::points);
+        record.subdivisions(intervals.size());
+        record.error(abserr);
+
+        return result;
+    }
+
+    namespace implementation
+    {
+        template <>
+        void integrate_components<GSL::QNG>(const fdd_components & f, const std::size_t & k, const std::size_t & group_size,
+                const double & a, const double & b, const GSL::QNG::Config & config, double * result,
+                const IntegrationSite & site)
+        {
+            IntegrationStatistics::Record record(site, "QNG");
+
+            if ((0 == group_size) || (0 != k % group_size))
+                throw InternalError("integrate_components: number of components must be a multiple of the group size");
+
+            const std::size_t groups = k / group_size;
+            std::array<double, Gauss<10>::points> x;
+            std::vector<double> y(Gauss<10>::points * k), values(k), errors(groups), abserr(groups);
+
+            // apply the 21-point rule on 1, 2 and 4 equal subintervals, evaluating all components at once
+            for (unsigned m = 1 ; m <= 4 ; m *= 2)
+            {
+                const double h = (b - a) / m;
+
+                std::fill(result, result + k, 0.0);
+                std::fill(abserr.begin(), abserr.end(), 0.0);
+                for (unsigned i = 0 ; i < m ; ++i)
+                {
+                    const double lower = a + i * h, upper = (i + 1 == m) ? b : a + (i + 1) * h;
+
+                    gauss_kronrod::abscissae<10>(lower, upper, x.data());
+                    for (unsigned j = 0 ; j < Gauss<10>::points ; ++j)
+                    {
+                        f(x[j], &y[j * k]);
+                    }
+
+                    gauss_kronrod::apply_components<10>(lower, upper, y.data(), k, group_size, values.data(), errors.data());
+                    for (std::size_t c = 0 ; c < k ; ++c)
+                    {
+                        result[c] += values[c];
+                    }
+                    for (std::size_t g = 0 ; g < groups ; ++g)
+                    {
+                        abserr[g] += errors[g];
+                    }
+                }
+
+                record.evaluations(2 * m * Gauss<10>::points - Gauss<10>::points);
+                record.subdivisions(m);
+                record.error(*std::max_element(abserr.begin(), abserr.end()));
+
+                if (gauss_kronrod::converged(result, abserr.data(), k, group_size, config.epsabs(), config.epsrel()))
+                    return;
+            }
+
+            throw IntegrationError(gsl_strerror(GSL_ETOL));
+        }
+
+        template <>
+        void integrate_components<GSL::QAGS>(const fdd_components & f, const std::size_t & k, const std::size_t & group_size,
+                const double & a, const double & b, const GSL::QAGS::Config & config, double * result,
+                const IntegrationSite & site)
+        {
+            IntegrationStatistics::Record record(site, "QAGS");
+
+            if (2 != config.key())
+                throw IntegrationError("vector-valued QAGS only supports the 21-point Gauss-Kronrod rule (key = 2)");
+
+            if ((0 == group_size) || (0 != k % group_size))
+                throw InternalError("integrate_components: number of components must be a multiple of the group size");
+
+            const std::size_t groups = k / group_size;
+
+            struct Interval
+            {
+                double a, b;
+                std::vector<double> values, errors;
+
+                // the largest error estimate of any group, relative to its tolerance
+                double priority;
+
+                bool operator< (const Interval & rhs) const
+                {
+                    return priority < rhs.priority;
+                }
+            };
+
+            std::array<double, Gauss<10>::points> x;
+            std::vector<double> y(Gauss<10>::points * k);
+
+            // evaluate all components at each abscissa of the rule on [lower, upper]
+            auto evaluate = [&] (const double & lower, const double & upper)
+            {
+                Interval result{ lower, upper, std::vector<double>(k), std::vector<double>(groups), 0.0 };
+
+                gauss_kronrod::abscissae<10>(lower, upper, x.data());
+                for (unsigned j = 0 ; j < Gauss<10>::points ; ++j)
+                {
+                    f(x[j], &y[j * k]);
+                }
+                gauss_kronrod::apply_components<10>(lower, upper, y.data(), k, group_size, result.values.data(), result.errors.data());
+
+                return result;
+            };
+
+            Interval initial = evaluate(a, b);
+
+            // the tolerances of the groups, as estimated on the whole domain, determine which subinterval to bisect next
+            std::vector<double> scales = gauss_kronrod::group_norms(initial.values.data(), k, group_size);
+            for (auto & s : scales)
+            {
+                s = std::max({ config.epsabs(), config.epsrel() * s, std::numeric_limits<double>::min() });
+            }
+
+            auto prioritize = [&scales] (Interval & i)
+            {
+                i.priority = 0.0;
+                for (std::size_t g = 0 ; g < i.errors.size() ; ++g)
+                {
+                    i.priority = std::max(i.priority, i.errors[g] / scales[g]);
+                }
+            };
+            prioritize(initial);
+
+            std::copy(initial.values.begin(), initial.values.end(), result);
+            std::vector<double> abserr(initial.errors);
+
+            // max-heap of subintervals, ordered by their priorities
+            std::vector<Interval> intervals{ initial };
+
+            const int limit = GSL::QAGS::Workspace::default_limit;
+            for (int iteration = 1 ; ; ++iteration)
+            {
+                if (gauss_kronrod::converged(result, abserr.data(), k, group_size, config.epsabs(), config.epsrel()))
+                    break;
+
+                if (iteration >= limit)
+                    throw IntegrationError(gsl_strerror(GSL_EMAXITER));
+
+                // bisect the subinterval with the highest priority
+                std::pop_heap(intervals.begin(), intervals.end());
+                const Interval worst = std::move(intervals.back());
+                intervals.pop_back();
+
+                const double mid = 0.5 * (worst.a + worst.b);
+                if ((mid <= std::min(worst.a, worst.b)) || (mid >= std::max(worst.a, worst.b)))
+                    throw IntegrationError(gsl_strerror(GSL_ESING));
+
+                Interval lower = evaluate(worst.a, mid);
+                Interval upper = evaluate(mid, worst.b);
+                prioritize(lower);
+                prioritize(upper);
+
+                for (std::size_t c = 0 ; c < k ; ++c)
+                {
+                    result[c] += lower.values[c] + upper.values[c] - worst.values[c];
+                }
+                for (std::size_t g = 0 ; g < groups ; ++g)
+                {
+                    abserr[g] += lower.errors[g] + upper.errors[g] - worst.errors[g];
+                }
+
+                intervals.push_back(std::move(lower));
+                std::push_heap(intervals.begin(), intervals.end());
+                intervals.push_back(std::move(upper));
+                std::push_heap(intervals.begin(), intervals.end());
+            }
+
+            // avoid accumulated round-off errors in the running sums
+            std::fill(result, result + k, 0.0);
+            for (const auto & i : intervals)
+            {
+                for (std::size_t c = 0 ; c < k ; ++c)
+                {
+                    result[c] += i.values[c];
+                }
+            }
+
+            record.evaluations((2 * intervals.size() - 1) * Gauss<10>::points);
+            record.subdivisions(intervals.size());
+            record.error(*std::max_element(abserr.begin(), abserr.end()));
+        }
+    }
+
     namespace cubature
     {
+        const char * method(const Backend & backend)
+        {
+            switch (backend)
+            {
+                case Backend::hcubature:
+                    return "hcubature";
+
+                case Backend::pcubature:
+                    return "pcubature";
+
+                case Backend::lattice:
+                    return "lattice";
+            }
+
+            throw InternalError("cubature::method: unknown backend");
+        }
+
         Config::Config() :
             _qng(),
-            _maxeval(50000)
+            _maxeval(50000),
+            _backend(Backend::hcubature)
         {
         }
 
@@ -322,6 +1232,140 @@ namespace eos
             _maxeval = x;
             return *this;
         }
+
+        Backend Config::backend() const
+        {
+            return _backend;
+        }
+
+        Config & Config::backend(const Backend & x)
+        {
+            _backend = x;
+            return *this;
+        }
+
+        double lattice(const std::function<void (const double *, double *, const std::size_t &)> & f, const unsigned & dim,
+                const double * a, const double * b, const Config & config, const IntegrationSite & site)
+        {
+            IntegrationStatistics::Record record(site, "lattice");
+
+            // generating vector of an embedded rank-1 lattice sequence in base 2, constructed component by component
+            // for order-2 weights and 2^10 to 2^20 points, as published by F. Y. Kuo in lattice-39102-1024-1048576.3600
+            // at https://web.maths.unsw.edu.au/~fkuo/lattice/, see R. Cools, F. Y. Kuo, D. Nuyens,
+            // SIAM J. Sci. Comput. 28 (2006) 2162; these are its first 10 components
+            static constexpr std::uint64_t generator[10] =
+            {
+                1, 182667, 469891, 498753, 110745, 446247, 250185, 118627, 245333, 283199
+            };
+            static constexpr unsigned max_log2_points = 18;
+
+            // the first lattice comprises 2^6 points
+            static constexpr unsigned initial_log2_points = 6;
+
+            // number of independently shifted copies of the lattice, which provide the error estimate
+            static constexpr unsigned shifts = 8;
+
+            if ((0 == dim) || (dim > sizeof(generator) / sizeof(generator[0])))
+                throw IntegrationError("lattice rule is only available for 1 to 10 variables");
+
+            double volume = 1.0;
+            for (unsigned j = 0 ; j < dim ; ++j)
+            {
+                volume *= b[j] - a[j];
+            }
+
+            // draw the shifts from a generator with a fixed seed, for reproducible results
+            std::mt19937 rng(5489u);
+            std::uniform_real_distribution<double> uniform(0.0, 1.0);
+            std::vector<double> shift(shifts * dim);
+            for (auto & s : shift)
+            {
+                s = uniform(rng);
+            }
+
+            std::vector<double> sums(shifts, 0.0);
+            std::vector<double> x, y;
+
+            // evaluate f at the points with indices k = first, first + step, ... < n of all shifted lattices with n points
+            auto evaluate = [&] (const std::uint64_t & n, const std::uint64_t & first, const std::uint64_t & step)
+            {
+                const std::size_t count = (n - first + step - 1) / step;
+
+                x.resize(shifts * count * dim);
+                y.resize(shifts * count);
+
+                std::size_t i = 0;
+                for (unsigned r = 0 ; r < shifts ; ++r)
+                {
+                    for (std::uint64_t k = first ; k < n ; k += step, ++i)
+                    {
+                        for (unsigned j = 0 ; j < dim ; ++j)
+                        {
+                            double u = static_cast<double>((k * generator[j]) % n) / n + shift[r * dim + j];
+                            u -= std::floor(u);
+
+                            // periodize the integrand with the tent transformation
+                            u = 1.0 - std::abs(2.0 * u - 1.0);
+
+                            x[i * dim + j] = a[j] + (b[j] - a[j]) * u;
+                        }
+                    }
+                }
+
+                f(x.data(), y.data(), shifts * count);
+
+                i = 0;
+                for (unsigned r = 0 ; r < shifts ; ++r)
+                {
+                    for (std::size_t c = 0 ; c < count ; ++c, ++i)
+                    {
+                        sums[r] += y[i];
+                    }
+                }
+            };
+
+            std::uint64_t n = std::uint64_t(1) << initial_log2_points;
+            evaluate(n, 0, 1);
+            std::size_t evaluations = shifts * n;
+
+            double result;
+            for (unsigned m = initial_log2_points ; ; ++m)
+            {
+                // mean and standard error of the estimates from the shifted lattices
+                double mean = 0.0;
+                for (const auto & s : sums)
+                {
+                    mean += s / n;
+                }
+                mean /= shifts;
+
+                double variance = 0.0;
+                for (const auto & s : sums)
+                {
+                    variance += (s / n - mean) * (s / n - mean);
+                }
+                variance /= shifts * (shifts - 1);
+
+                result = volume * mean;
+                const double error = std::abs(volume) * std::sqrt(variance);
+
+                record.evaluations(evaluations);
+                record.error(error);
+
+                if (error <= std::max(config.epsabs(), config.epsrel() * std::abs(result)))
+                    break;
+
+                if ((max_log2_points == m) || (evaluations + shifts * n > config.maxeval()))
+                    break;
+
+                // double the number of points; the previous points are the even-indexed ones
+                evaluate(2 * n, 1, 2);
+                evaluations += shifts * n;
+                n *= 2;
+            }
+
+            return result;
+        }
     }
 
     IntegrationError::IntegrationError(const std::string & message) throw () :
@@ -23,6 +23,7 @@
 
 #include <eos/utils/complex.hh>
 #include <eos/utils/exception.hh>
+#include <eos/utils/integration-statistics.hh>
 
 // TODO Didn't manage to forward declare C struct
 // struct gsl_integration_workspace;
@@ -39,22 +40,39 @@ namespace eos
     /*!
      * Numerically integrate functions of one real-valued parameter.
      *
-     * Uses the Delta^2-Rule by Aitkin to refine the result.
+     * Uses the Delta^2-Rule by Aitkin to refine the result. If the correction
+     * is too large, the number of sampling points is doubled. In that case
+     * only the new midpoints are evaluated, and all previous evaluations are reused.
      *
-     * @param f      Integrand.
-     * @param n      Number of evaluations, must be a power of 2.
-     * @param a      Lower limit of the domain of integration.
-     * @param b      Upper limit of the domain of integration.
+     * @param f           Integrand.
+     * @param n           Number of evaluations, must be a power of 2.
+     * @param a           Lower limit of the domain of integration.
+     * @param b           Upper limit of the domain of integration.
+     * @param evaluations (Optional) pointer that receives the total number of calls of the integrand.
+     * @param site        (Optional) call site, recorded by IntegrationStatistics. Defaults to the location of the caller.
      */
-    double integrate1D(const std::function<double (const double &)> & f, unsigned n, const double & a, const double & b);
-    complex<double> integrate1D(const std::function<complex<double> (const double &)> & f, unsigned n, const double & a, const double & b);
+    double integrate1D(const std::function<double (const double &)> & f, unsigned n, const double & a, const double & b,
+            unsigned * evaluations = nullptr, const IntegrationSite & site = IntegrationSite());
+    complex<double> integrate1D(const std::function<complex<double> (const double &)> & f, unsigned n, const double & a, const double & b,
+            unsigned * evaluations = nullptr, const IntegrationSite & site = IntegrationSite());
 
-    template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b);
+    template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b,
+            unsigned * evaluations = nullptr, const IntegrationSite & site = IntegrationSite());
     /// @}
 
 namespace GSL
 {
     using fdd = std::function<double(const double &)>;
+
+    /*!
+     * Vectorised integrand of one real-valued variable.
+     *
+     * Evaluates the integrand at the n abscissae x[0], ..., x[n - 1] and
+     * writes the results to y[0], ..., y[n - 1]. This allows integrands to
+     * share setup costs across a batch of abscissae.
+     */
+    using fdd_v = std::function<void (const double * x, double * y, const std::size_t & n)>;
+
     struct QNG
     {
         class Config
@@ -74,10 +92,20 @@ namespace GSL
 
     struct QAGS
     {
+        /*!
+         * Workspace of the GSL for up to limit subintervals.
+         *
+         * integrate<QAGS> takes its workspaces from a stack that is private to the calling
+         * thread. Nested integrations, i.e., integrands that call integrate<QAGS> themselves,
+         * use one workspace per level of nesting. Workspaces are allocated on first use
+         * and reused by all later integrations on the same thread.
+         */
         class Workspace
         {
         public:
-            Workspace(int limit = 5000);
+            static constexpr int default_limit = 5000;
+
+            Workspace(int limit = default_limit);
             Workspace(const Workspace &) = delete;
             Workspace(Workspace &&) = delete;
             ~Workspace();
@@ -107,10 +135,30 @@ namespace GSL
                 int _key;
         };
     };
-
-    static thread_local QAGS::Workspace work_space;
 }
 
+    /*!
+     * Gauss-Kronrod quadrature with precomputed nodes and weights.
+     *
+     * Applies the (2 n_ + 1)-point Kronrod extension of the n_-point Gauss-Legendre
+     * rule once on the whole domain of integration, at a fixed cost of 2 n_ + 1 integrand
+     * calls. The difference to the embedded Gauss rule provides the error estimate. If it
+     * exceeds the tolerance of the Config, an IntegrationError is thrown.
+     *
+     * Available for n_ = 7, 10, 15 and 20.
+     */
+    template <unsigned n_>
+    struct Gauss
+    {
+        static_assert((7 == n_) || (10 == n_) || (15 == n_) || (20 == n_), "Gauss<n_> is only available for n_ = 7, 10, 15 and 20");
+
+        /// The number of integrand calls.
+        static constexpr unsigned points = 2 * n_ + 1;
+
+        /// The same absolute and relative tolerances as for QNG.
+        using Config = GSL::QNG::Config;
+    };
+
     /*!
      * Numerically integrate functions of one real-valued parameter.
      *
@@ -118,17 +166,109 @@ namespace GSL
      * GNU scientific library are wrapped:
      * 1) `QNG`: the non-adaptive Gauss-Kronrod rule
      * 2) `QAGS`: the adaptive Clenshaw-Kurtis rule
+     *
+     * In addition, `Gauss<n_>` applies a single Gauss-Kronrod rule with precomputed nodes.
+     *
+     * All integration routines record their call site with IntegrationStatistics, if enabled.
      */
     template <typename Method_>
     double integrate(const std::function<double(const double &)> & f,
                      const double &a, const double &b,
-                     const typename Method_::Config &config = typename Method_::Config());
+                     const typename Method_::Config &config = typename Method_::Config(),
+                     const IntegrationSite & site = IntegrationSite());
+
+    /*!
+     * Numerically integrate vectorised functions of one real-valued parameter.
+     *
+     * The integrand is evaluated in batches of abscissae, using the 21-point
+     * Gauss-Kronrod rule:
+     * 1) `QNG`: non-adaptive, applying the rule on 1, 2 and 4 equal subintervals
+     *    until the requested tolerance is reached.
+     * 2) `QAGS`: adaptive bisection of the subinterval with the largest error,
+     *    evaluating both halves in one batch of 42 abscissae. Only the default
+     *    key (2, the 21-point rule) is supported.
+     */
+    template <typename Method_>
+    double integrate(const GSL::fdd_v & f,
+                     const double &a, const double &b,
+                     const typename Method_::Config &config = typename Method_::Config(),
+                     const IntegrationSite & site = IntegrationSite());
+
+    /*!
+     * Numerically integrate vectorised functions of one real-valued parameter.
+     *
+     * As integrate1D above, but all sampling points of the initial grid, and all
+     * new midpoints of each refinement, are evaluated in one batch.
+     */
+    double integrate1D(const GSL::fdd_v & f, unsigned n, const double & a, const double & b,
+            unsigned * evaluations = nullptr, const IntegrationSite & site = IntegrationSite());
+
+    /// @{
+    /*!
+     * Numerically integrate vector-valued functions of one real-valued parameter.
+     *
+     * All components are integrated at once, i.e., they share the sampling points and,
+     * for `QAGS`, the subdivision of the domain of integration. The requested tolerance
+     * must be met for each component. For complex-valued integrands, it applies to the
+     * modulus of the result rather than to its real and imaginary parts.
+     *
+     * Both `QNG` and `QAGS` are supported, with the same rules as for vectorised integrands.
+     */
+    template <typename Method_, std::size_t k_>
+    std::array<double, k_> integrate(const std::function<std::array<double, k_> (const double &)> & f,
+                     const double &a, const double &b,
+                     const typename Method_::Config &config = typename Method_::Config(),
+                     const IntegrationSite & site = IntegrationSite());
+
+    template <typename Method_, typename T_>
+    complex<T_> integrate(const std::function<complex<T_> (const double &)> & f,
+                     const double &a, const double &b,
+                     const typename Method_::Config &config = typename Method_::Config(),
+                     const IntegrationSite & site = IntegrationSite());
+    /// @}
 
 namespace cubature
 {
     template <size_t dim_>
     using fdd = std::function<double(const std::array<double, dim_> &)>;
 
+    /*!
+     * Vectorised integrand of dim_ real-valued variables.
+     *
+     * Evaluates the integrand at the n points x[i * dim_ + j], j = 0, ..., dim_ - 1,
+     * and writes the results to y[i], for i = 0, ..., n - 1.
+     */
+    template <size_t dim_>
+    using fdd_v = std::function<void (const double * x, double * y, const std::size_t & n)>;
+
+    /*!
+     * Backends for the integration of functions of more than one variable.
+     */
+    enum class Backend
+    {
+        /// Adaptive subdivision of the domain of integration, using hcubature.
+        hcubature,
+        /*!
+         * Nested Clenshaw-Curtis rules of increasing degree on the whole domain, using pcubature.
+         *
+         * Converges faster than hcubature for smooth integrands in few variables.
+         */
+        pcubature,
+        /*!
+         * Rank-1 lattice rule with randomly shifted copies of the lattice.
+         *
+         * The integrand is periodized with the tent transformation. The number of lattice
+         * points is doubled until the standard error across the shifted copies meets the
+         * tolerance, reusing all previous evaluations. The shifts are drawn from a generator
+         * with a fixed seed, so that results are reproducible. Available for up to 10 variables.
+         * The lattice is optimized for the projections onto single variables and pairs of variables.
+         */
+        lattice
+    };
+
+    /// Name of the backend, as recorded in the IntegrationStatistics.
+    const char * method(const Backend & backend);
+
     class Config
     {
     public:
@@ -142,21 +282,55 @@ namespace cubature
 
         size_t maxeval() const;
         Config& maxeval(const size_t& x);
+
+        Backend backend() const;
+        Config& backend(const Backend& x);
     private:
         GSL::QNG::Config _qng;
         size_t _maxeval;
+        Backend _backend;
     };
 }
 
     /*!
      * Numerically integrate functions of one or more than one variable with
-     * cubature methods.
+     * cubature methods, using the backend selected in the Config.
+     *
+     * If the maximal number of evaluations is reached before the requested
+     * tolerance, the current estimate is returned.
      */
     template <size_t dim_>
     double integrate(const std::function<double(const std::array<double, dim_> &)> & f,
                      const std::array<double, dim_> &a,
                      const std::array<double, dim_> &b,
-                     const cubature::Config &config = cubature::Config());
+                     const cubature::Config &config = cubature::Config(),
+                     const IntegrationSite & site = IntegrationSite());
+
+    /*!
+     * Numerically integrate vectorised functions of one or more than one variable
+     * with cubature methods, evaluating the integrand in batches of points.
+     * For the lattice backend, all new points of each refinement form one batch.
+     */
+    template <size_t dim_>
+    double integrate(const cubature::fdd_v<dim_> & f,
+                     const std::array<double, dim_> &a,
+                     const std::array<double, dim_> &b,
+                     const cubature::Config &config = cubature::Config(),
+                     const IntegrationSite & site = IntegrationSite());
+
+    /*!
+     * Numerically integrate vector-valued functions of one or more than one variable
+     * with cubature methods.
+     *
+     * All components share the evaluation points and the subdivision of the domain of
+     * integration. The requested tolerance must be met by each component.
+     */
+    template <size_t dim_, size_t k_>
+    std::array<double, k_> integrate(const std::function<std::array<double, k_> (const std::array<double, dim_> &)> & f,
+                     const std::array<double, dim_> &a,
+                     const std::array<double, dim_> &b,
+                     const cubature::Config &config = cubature::Config(),
+                     const IntegrationSite & site = IntegrationSite());
 
     class IntegrationError :
         public Exception
@@ -0,0 +1,129 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/form-factors/analytic-b-to-v-lcsr.hh>
+#include <eos/utils/integrate-impl.hh>
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/*
+ * Compare the cubature backends in terms of integrand calls and wall time.
+ *
+ * Build with 'make integrate_BENCHMARK' and run without arguments.
+ */
+
+using namespace eos;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double milliseconds(const Clock::time_point & start, const Clock::time_point & stop)
+    {
+        return std::chrono::duration<double, std::milli>(stop - start).count();
+    }
+
+    template <size_t dim_>
+    void benchmark(const std::string & name, const std::function<double (const std::array<double, dim_> &)> & f,
+            const std::array<double, dim_> & a, const std::array<double, dim_> & b)
+    {
+        for (auto epsrel : { 1.0e-3, 1.0e-4 })
+        {
+            for (auto backend : { cubature::Backend::hcubature, cubature::Backend::lattice })
+            {
+                unsigned calls = 0;
+                std::function<double (const std::array<double, dim_> &)> g = [&] (const std::array<double, dim_> & x)
+                {
+                    ++calls;
+                    return f(x);
+                };
+
+                auto start = Clock::now();
+                double result = integrate(g, a, b, cubature::Config().epsrel(epsrel).backend(backend));
+                auto stop = Clock::now();
+
+                std::cout << std::setw(12) << name
+                          << std::setw(8) << epsrel
+                          << std::setw(12) << (cubature::Backend::lattice == backend ? "lattice" : "hcubature")
+                          << std::setw(18) << std::setprecision(10) << result << std::setprecision(6)
+                          << std::setw(10) << calls
+                          << std::setw(12) << milliseconds(start, stop) << " ms" << std::endl;
+            }
+        }
+    }
+}
+
+int main(int, char **)
+{
+    std::cout << "# synthetic integrands: name, epsrel, backend, result, calls, wall time" << std::endl;
+
+    // shape of the three-particle LCSR integrands: exponential suppression in sigma, polynomial in the momentum fractions
+    benchmark<3>("lcsr-like", [] (const std::array<double, 3> & x)
+    {
+        return std::exp(-5.0 * x[0] / (1.0 - x[0])) * (1.0 + x[1] * x[2]) * x[2] * (1.0 - x[1]) / std::pow(1.0 + x[0] * x[1], 2);
+    }, { 0.0, 0.0, 0.0 }, { 0.7, 1.0, 1.0 });
+
+    // Morokoff test function, with integrable singularities on the boundaries
+    benchmark<4>("morokoff", [] (const std::array<double, 4> & x)
+    {
+        double result = std::pow(1.25, 4);
+        for (auto xi : x)
+            result *= std::pow(xi, 0.25);
+
+        return result;
+    }, { 0.0, 0.0, 0.0, 0.0 }, { 1.0, 1.0, 1.0, 1.0 });
+
+    benchmark<3>("gaussian", [] (const std::array<double, 3> & x)
+    {
+        return std::exp(-(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]));
+    }, { 0.0, 0.0, 0.0 }, { 1.0, 1.0, 1.0 });
+
+    std::cout << "# B->K^* form factors at the default tolerances: backend, q2, V, A_1, A_12, wall time" << std::endl;
+
+    for (auto backend : { "hcubature", "lattice" })
+    {
+        Parameters p = Parameters::Defaults();
+        Options o = {
+            { "2pt",             "all"   },
+            { "3pt",             "all"   },
+            { "integration-3pt", backend }
+        };
+        AnalyticFormFactorBToVLCSR<lcsr::BToKstar> ff{ p, o };
+
+        for (auto q2 : { -5.0, 0.0, 5.0 })
+        {
+            auto start = Clock::now();
+            double v = ff.v(q2), a_1 = ff.a_1(q2), a_12 = ff.a_12(q2);
+            auto stop = Clock::now();
+
+            std::cout << std::setw(12) << backend
+                      << std::setw(6) << q2
+                      << std::setw(14) << std::setprecision(8) << v
+                      << std::setw(14) << a_1
+                      << std::setw(14) << a_12 << std::setprecision(6)
+                      << std::setw(12) << milliseconds(start, stop) << " ms" << std::endl;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
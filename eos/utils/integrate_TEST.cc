@@ -19,9 +19,13 @@
 
 #include <test/test.hh>
 #include <eos/utils/integrate-impl.hh>
+#include <eos/utils/power_of.hh>
+#include <eos/utils/stringify.hh>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <set>
 
 #include <iostream>
 
@@ -78,6 +82,26 @@ class IntegrateTest :
             std::cout << "\\int_0.0^exp(1) f4(x) dx = " << q4 << ", eps = " << std::abs(i4 - q4) / q4 << " over 16 points" << std::endl;
             TEST_CHECK_RELATIVE_ERROR(i4, q4, eps);
 
+            // refinement reuses previous evaluations
+            {
+                std::set<double> abscissas;
+                unsigned calls = 0;
+                auto f5 = std::function<double (const double &)>([&](const double & x) { ++calls; abscissas.insert(x); return std::sin(50.0 * x); });
+                unsigned evaluations = 0;
+                double q5 = integrate1D(f5, 16, 0.0, 1.0, &evaluations), i5 = (1.0 - std::cos(50.0)) / 50.0;
+                std::cout << "\\int_0.0^1.0 sin(50 x) dx = " << q5 << ", eps = " << std::abs(i5 - q5) / q5 << " over " << evaluations << " points" << std::endl;
+                TEST_CHECK_RELATIVE_ERROR(i5, q5, eps);
+                TEST_CHECK_EQUAL(evaluations, 65u);
+                TEST_CHECK_EQUAL(calls, evaluations);
+                TEST_CHECK_EQUAL(abscissas.size(), evaluations);
+
+                auto f6 = std::function<std::array<double, 2> (const double &)>([&](const double & x) { return std::array<double, 2>{{ f5(x), 2.0 * f5(x) }}; });
+                auto q6 = integrate1D(f6, 16, 0.0, 1.0, &evaluations);
+                TEST_CHECK_RELATIVE_ERROR(q6[0], q5, 1e-12);
+                TEST_CHECK_RELATIVE_ERROR(q6[1], 2.0 * q5, 1e-12);
+                TEST_CHECK_EQUAL(evaluations, 65u);
+            }
+
             auto config_QNG = GSL::QNG::Config().epsrel(eps);
             q4 = integrate<GSL::QNG>(f4obj, 1.0, std::exp(1), config_QNG);
             std::cout << "\\int_0.0^exp(1) f4(x) dx = " << q4 << ", eps = " << std::abs(i4 - q4) / q4 << " with QNG" << std::endl;
@@ -88,6 +112,41 @@ class IntegrateTest :
             std::cout << "\\int_0.0^exp(1) f4(x) dx = " << q4 << ", eps = " << std::abs(i4 - q4) / q4 << " with QAGS" << std::endl;
             TEST_CHECK_RELATIVE_ERROR(i4, q4, eps);
 
+            // nested QAGS integrations use separate workspaces
+            {
+                // the integrable singularity requires many subintervals in the inner integration
+                auto inner = std::function<double (const double &)>([] (const double & y) { return 1.0 / std::sqrt(y); });
+                auto outer = std::function<double (const double &)>([&] (const double & x)
+                {
+                    return integrate<GSL::QAGS>(inner, 0.0, x, GSL::QAGS::Config().epsrel(1e-10));
+                });
+
+                // \int_0^1 dx \int_0^x dy y^(-1/2) = \int_0^1 dx 2 x^(1/2) = 4 / 3
+                double q = integrate<GSL::QAGS>(outer, 0.0, 1.0, GSL::QAGS::Config().epsrel(1e-8));
+                TEST_CHECK_RELATIVE_ERROR(4.0 / 3.0, q, 1e-8);
+
+                // the workspaces remain usable after the nested integrations
+                TEST_CHECK_RELATIVE_ERROR(2.0, outer(1.0), 1e-10);
+                TEST_CHECK_RELATIVE_ERROR(i4, integrate<GSL::QAGS>(f4obj, 1.0, std::exp(1), config_QAGS), eps);
+            }
+
+            // Gauss-Kronrod rules with precomputed nodes
+            {
+                unsigned calls = 0;
+                auto f7 = std::function<double (const double &)>([&](const double & x) { ++calls; return std::pow(x, 12); });
+                double q7 = integrate<Gauss<7>>(f7, 0.0, 1.0, Gauss<7>::Config().epsrel(1e-10));
+                TEST_CHECK_RELATIVE_ERROR(1.0 / 13.0, q7, 1e-14);
+                TEST_CHECK_EQUAL(calls, Gauss<7>::points);
+
+                TEST_CHECK_RELATIVE_ERROR(i4, integrate<Gauss<7>>(f4obj, 1.0, std::exp(1), Gauss<7>::Config().epsrel(1e-8)), 1e-12);
+                TEST_CHECK_RELATIVE_ERROR(i4, integrate<Gauss<10>>(f4obj, 1.0, std::exp(1), Gauss<10>::Config().epsrel(1e-8)), 1e-12);
+                TEST_CHECK_RELATIVE_ERROR(i3, integrate<Gauss<15>>(std::function<double (const double &)>(&f3), 0.0, 10.0, Gauss<15>::Config().epsrel(1e-8)), 1e-12);
+
+                auto f8 = std::function<double (const double &)>([](const double & x) { return std::sin(50.0 * x); });
+                TEST_CHECK_THROWS(IntegrationError, integrate<Gauss<7>>(f8, 0.0, 1.0, Gauss<7>::Config().epsrel(1e-8)));
+                TEST_CHECK_RELATIVE_ERROR((1.0 - std::cos(50.0)) / 50.0, integrate<Gauss<20>>(f8, 0.0, 1.0, Gauss<20>::Config().epsrel(1e-2)), 1e-2);
+            }
+
             auto config_cubature = cubature::Config().epsrel(eps);
             auto f4lam = [](const std::array<double, 1> &args) -> double {
                 return f4(args[0]);
@@ -111,5 +170,233 @@ class IntegrateTest :
             };
             auto q5 = integrate(cubature::fdd<dim>(f5lam), a_5, b_5, config_cubature);
             TEST_CHECK_RELATIVE_ERROR(q5, 1.0, eps);
+
+            // randomly shifted lattice rule
+            {
+                unsigned calls = 0;
+                auto f5counted = cubature::fdd<dim>([&](const std::array<double, dim> & x) { ++calls; return f5lam(x); });
+                auto config_lattice = cubature::Config().epsrel(eps).backend(cubature::Backend::lattice);
+
+                auto q5l = integrate(f5counted, a_5, b_5, config_lattice);
+                TEST_CHECK_RELATIVE_ERROR(q5l, 1.0, eps);
+                TEST_CHECK(calls <= config_lattice.maxeval());
+
+                // the shifts are reproducible
+                TEST_CHECK_EQUAL(integrate(f5counted, a_5, b_5, config_lattice), q5l);
+
+                // the maximal number of evaluations is respected
+                calls = 0;
+                integrate(f5counted, a_5, b_5, cubature::Config().epsrel(1e-12).maxeval(5000).backend(cubature::Backend::lattice));
+                TEST_CHECK(calls <= 5000u);
+                TEST_CHECK(calls > 0u);
+
+                // convergence order for a smooth periodic integrand, built from the Bernoulli polynomial B_4
+                // such that its Fourier coefficients decay as 1 / h^4; the exact integral is 1
+                auto f8 = cubature::fdd<2>([] (const std::array<double, 2> & x)
+                {
+                    double result = 1.0;
+                    for (unsigned j = 0 ; j < 2 ; ++j)
+                    {
+                        const double b4 = power_of<4>(x[j]) - 2.0 * power_of<3>(x[j]) + power_of<2>(x[j]) - 1.0 / 30.0;
+                        result *= 1.0 - 2.0 * power_of<4>(M_PI) / 3.0 * b4 / power_of<2>(j + 1.0);
+                    }
+                    return result;
+                });
+                constexpr std::array<double, 2> a_8 { 0, 0 };
+                constexpr std::array<double, 2> b_8 { 1, 1 };
+
+                // 8 shifted copies of lattices with 2^8 and 2^12 points, respectively
+                const double error_coarse = std::abs(integrate(f8, a_8, b_8, cubature::Config().epsrel(0.0).maxeval(8u << 8).backend(cubature::Backend::lattice)) - 1.0);
+                const double error_fine   = std::abs(integrate(f8, a_8, b_8, cubature::Config().epsrel(0.0).maxeval(8u << 12).backend(cubature::Backend::lattice)) - 1.0);
+
+                // 16 times as many points reduce the error at least as O(n^-2), while Monte Carlo achieves only O(n^-1/2)
+                TEST_CHECK(error_fine < 1e-8);
+                TEST_CHECK(error_fine * power_of<2>(16.0) < error_coarse);
+            }
+
+            // vectorised integrands
+            {
+                unsigned batches = 0, calls = 0;
+                auto f4v = GSL::fdd_v([&](const double * x, double * y, const std::size_t & n)
+                {
+                    ++batches;
+                    calls += n;
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                        y[i] = f4(x[i]);
+                });
+
+                unsigned evaluations = 0;
+                double q = integrate1D(f4v, 16, 1.0, std::exp(1), &evaluations);
+                TEST_CHECK_EQUAL(q, integrate1D(f4obj, 16, 1.0, std::exp(1)));
+                TEST_CHECK_EQUAL(evaluations, calls);
+                TEST_CHECK_EQUAL(batches, 1u);
+
+                batches = 0;
+                q = integrate<GSL::QNG>(f4v, 1.0, std::exp(1), config_QNG);
+                TEST_CHECK_RELATIVE_ERROR(i4, q, eps);
+                TEST_CHECK_EQUAL(batches, 1u);
+
+                batches = 0;
+                q = integrate<GSL::QAGS>(f4v, 1.0, std::exp(1), config_QAGS);
+                TEST_CHECK_RELATIVE_ERROR(i4, q, 1e-12);
+                TEST_CHECK(batches <= 3u);
+
+                // integrable singularity at the lower limit requires many bisections
+                batches = 0;
+                calls = 0;
+                auto f6v = GSL::fdd_v([&](const double * x, double * y, const std::size_t & n)
+                {
+                    ++batches;
+                    calls += n;
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                        y[i] = 1.0 / std::sqrt(x[i]);
+                });
+                q = integrate<GSL::QAGS>(f6v, 0.0, 1.0, GSL::QAGS::Config().epsrel(1e-10));
+                TEST_CHECK_RELATIVE_ERROR(2.0, q, 1e-10);
+                TEST_CHECK_EQUAL(calls, 21u + (batches - 1u) * 42u);
+
+                TEST_CHECK_THROWS(IntegrationError, integrate<GSL::QAGS>(f6v, 0.0, 1.0, GSL::QAGS::Config().key(1)));
+
+                auto f5v = cubature::fdd_v<dim>([&](const double * x, double * y, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        std::array<double, dim> args;
+                        std::copy(x + i * dim, x + (i + 1) * dim, args.begin());
+                        y[i] = f5lam(args);
+                    }
+                });
+                TEST_CHECK_EQUAL(integrate(f5v, a_5, b_5, config_cubature), q5);
+
+                // p-adaptive cubature, for smooth integrands
+                auto f7v = cubature::fdd_v<dim>([&](const double * x, double * y, const std::size_t & n)
+                {
+                    ++batches;
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        y[i] = std::exp(x[i * dim] + x[i * dim + 1] + x[i * dim + 2] + x[i * dim + 3]);
+                    }
+                });
+                auto f7 = cubature::fdd<dim>([] (const std::array<double, dim> & x)
+                {
+                    return std::exp(x[0] + x[1] + x[2] + x[3]);
+                });
+                auto config_pcubature = cubature::Config().epsrel(1e-10).backend(cubature::Backend::pcubature);
+                batches = 0;
+                const double q7 = integrate(f7v, a_5, b_5, config_pcubature);
+                TEST_CHECK_RELATIVE_ERROR(q7, std::pow(std::exp(1.0) - 1.0, 4), 1e-10);
+                TEST_CHECK(batches > 0u);
+                TEST_CHECK_RELATIVE_ERROR(integrate(f7, a_5, b_5, config_pcubature), q7, 1e-14);
+
+                // all components share the evaluations, and meet the tolerance individually
+                calls = 0;
+                std::function<std::array<double, 2> (const std::array<double, dim> &)> f5c = [&] (const std::array<double, dim> & x) -> std::array<double, 2>
+                {
+                    ++calls;
+                    return {{ f5lam(x), 2.0 * f5lam(x) + 1.0 }};
+                };
+                auto q5c = integrate(f5c, a_5, b_5, config_cubature);
+                TEST_CHECK_RELATIVE_ERROR(q5c[0], 1.0, eps);
+                TEST_CHECK_RELATIVE_ERROR(q5c[1], 3.0, eps);
+                TEST_CHECK(calls <= config_cubature.maxeval());
+
+                auto q7c = integrate(std::function<std::array<double, 2> (const std::array<double, dim> &)>([&] (const std::array<double, dim> & x) -> std::array<double, 2>
+                {
+                    return {{ f7(x), 2.0 * f7(x) }};
+                }), a_5, b_5, config_pcubature);
+                TEST_CHECK_RELATIVE_ERROR(q7c[0], q7, 1e-10);
+                TEST_CHECK_RELATIVE_ERROR(q7c[1], 2.0 * q7, 1e-10);
+            }
+
+            // vector-valued integrands
+            {
+                unsigned calls = 0;
+                std::function<std::array<double, 2> (const double &)> f = [&calls] (const double & x) -> std::array<double, 2>
+                {
+                    ++calls;
+                    return {{ std::exp(x), std::sin(x) }};
+                };
+
+                auto q = integrate<GSL::QNG>(f, 0.0, 1.0, GSL::QNG::Config().epsrel(1e-10));
+                TEST_CHECK_RELATIVE_ERROR(std::exp(1.0) - 1.0, q[0], 1e-10);
+                TEST_CHECK_RELATIVE_ERROR(1.0 - std::cos(1.0), q[1], 1e-10);
+                TEST_CHECK_EQUAL(calls, 21u);
+
+                // the component with the integrable singularity determines the shared subdivision
+                calls = 0;
+                std::function<std::array<double, 2> (const double &)> g = [&calls] (const double & x) -> std::array<double, 2>
+                {
+                    ++calls;
+                    return {{ x, 1.0 / std::sqrt(x) }};
+                };
+
+                q = integrate<GSL::QAGS>(g, 0.0, 1.0, GSL::QAGS::Config().epsrel(1e-10));
+                TEST_CHECK_RELATIVE_ERROR(0.5, q[0], 1e-10);
+                TEST_CHECK_RELATIVE_ERROR(2.0, q[1], 1e-10);
+                TEST_CHECK(calls > 21u);
+                TEST_CHECK_EQUAL((calls - 21u) % 42u, 0u);
+
+                // the tolerance applies to the modulus of complex-valued results
+                std::function<complex<double> (const double &)> h = [] (const double & x) { return std::polar(1.0, x); };
+
+                auto z = integrate<GSL::QNG>(h, 0.0, M_PI, GSL::QNG::Config().epsrel(1e-10));
+                TEST_CHECK_NEARLY_EQUAL(0.0, real(z), 1e-10);
+                TEST_CHECK_RELATIVE_ERROR(2.0, imag(z), 1e-10);
+
+                z = integrate<GSL::QAGS>(h, 0.0, M_PI, GSL::QAGS::Config().epsrel(1e-12));
+                TEST_CHECK_NEARLY_EQUAL(0.0, real(z), 1e-12);
+                TEST_CHECK_RELATIVE_ERROR(2.0, imag(z), 1e-12);
+            }
+
+            // integration statistics
+            {
+                auto f = GSL::fdd_v([] (const double * x, double * y, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                        y[i] = std::exp(x[i]);
+                });
+
+                unsigned calls = 0;
+                std::function<double (const std::array<double, 2> &)> g = [&calls] (const std::array<double, 2> & x)
+                {
+                    ++calls;
+                    return x[0] * x[1];
+                };
+
+                IntegrationStatistics::instance()->reset();
+                IntegrationStatistics::enable();
+
+                const unsigned line_f = __LINE__ + 3;
+                for (unsigned i = 0 ; i < 2 ; ++i)
+                {
+                    integrate<GSL::QAGS>(f, 0.0, 1.0);
+                }
+                const unsigned line_g = __LINE__ + 1;
+                integrate(g, { 0.0, 0.0 }, { 1.0, 1.0 });
+
+                // integrations are not recorded while disabled
+                IntegrationStatistics::enable(false);
+                integrate<GSL::QAGS>(f, 0.0, 1.0);
+
+                auto entries = IntegrationStatistics::instance()->entries();
+                TEST_CHECK_EQUAL(entries.size(), 2u);
+
+                std::sort(entries.begin(), entries.end(), [] (const IntegrationStatistics::Entry & lhs, const IntegrationStatistics::Entry & rhs) { return lhs.method < rhs.method; });
+
+                TEST_CHECK_EQUAL(entries[0].site,         std::string(__FILE__) + ":" + stringify(line_f));
+                TEST_CHECK_EQUAL(entries[0].method,       "QAGS");
+                TEST_CHECK_EQUAL(entries[0].calls,        2u);
+                TEST_CHECK_EQUAL(entries[0].evaluations,  2u * Gauss<10>::points);
+                TEST_CHECK_EQUAL(entries[0].subdivisions, 2u);
+                TEST_CHECK(entries[0].max_error <= 1.0e-4 * (std::exp(1.0) - 1.0));
+
+                TEST_CHECK_EQUAL(entries[1].site,         std::string(__FILE__) + ":" + stringify(line_g));
+                TEST_CHECK_EQUAL(entries[1].method,       "hcubature");
+                TEST_CHECK_EQUAL(entries[1].calls,        1u);
+                TEST_CHECK_EQUAL(entries[1].evaluations,  calls);
+
+                IntegrationStatistics::instance()->reset();
+                TEST_CHECK(IntegrationStatistics::instance()->entries().empty());
+            }
         }
 } model_test;
@@ -0,0 +1,190 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/integration-statistics.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
+namespace eos
+{
+    namespace integration_statistics
+    {
+        // recording is enabled from the start if EOS_INTEGRATION_STATISTICS is set
+        std::atomic<bool> enabled(nullptr != std::getenv("EOS_INTEGRATION_STATISTICS"));
+    }
+
+    template class InstantiationPolicy<IntegrationStatistics, Singleton>;
+
+    template <>
+    struct Implementation<IntegrationStatistics>
+    {
+        Mutex mutex;
+
+        // statistics, keyed on the call site 'file:line'
+        std::map<std::string, IntegrationStatistics::Entry> entries;
+
+        // dump the statistics at process exit, if requested via the environment
+        bool dump_at_exit;
+
+        Implementation() :
+            dump_at_exit(nullptr != std::getenv("EOS_INTEGRATION_STATISTICS"))
+        {
+        }
+    };
+
+    IntegrationStatistics::IntegrationStatistics() :
+        PrivateImplementationPattern<IntegrationStatistics>(new Implementation<IntegrationStatistics>)
+    {
+    }
+
+    IntegrationStatistics::~IntegrationStatistics()
+    {
+        if (_imp->dump_at_exit)
+            dump(std::cerr);
+    }
+
+    bool
+    IntegrationStatistics::enabled()
+    {
+        return integration_statistics::enabled.load(std::memory_order_relaxed);
+    }
+
+    void
+    IntegrationStatistics::enable(const bool & enabled)
+    {
+        integration_statistics::enabled.store(enabled);
+    }
+
+    void
+    IntegrationStatistics::add(const IntegrationSite & site, const char * method, const unsigned long & evaluations,
+            const unsigned long & subdivisions, const double & error, const double & seconds)
+    {
+        const std::string key = std::string(site.file) + ':' + stringify(site.line);
+
+        Lock l(_imp->mutex);
+
+        auto i = _imp->entries.find(key);
+        if (_imp->entries.end() == i)
+        {
+            i = _imp->entries.emplace(key, Entry{ key, method, 0, 0, 0, 0.0, 0.0 }).first;
+        }
+
+        Entry & e = i->second;
+        e.calls        += 1;
+        e.evaluations  += evaluations;
+        e.subdivisions += subdivisions;
+        e.max_error     = std::max(e.max_error, error);
+        e.seconds      += seconds;
+    }
+
+    std::vector<IntegrationStatistics::Entry>
+    IntegrationStatistics::entries() const
+    {
+        std::vector<Entry> result;
+
+        {
+            Lock l(_imp->mutex);
+
+            for (const auto & e : _imp->entries)
+            {
+                result.push_back(e.second);
+            }
+        }
+
+        std::stable_sort(result.begin(), result.end(), [] (const Entry & lhs, const Entry & rhs) { return lhs.seconds > rhs.seconds; });
+
+        return result;
+    }
+
+    void
+    IntegrationStatistics::reset()
+    {
+        Lock l(_imp->mutex);
+
+        _imp->entries.clear();
+    }
+
+    void
+    IntegrationStatistics::dump(std::ostream & stream) const
+    {
+        const std::vector<Entry> entries = this->entries();
+
+        stream << "# integration statistics: site, method, calls, evaluations, subdivisions, max. abs. error, wall time [s]" << std::endl;
+        for (const auto & e : entries)
+        {
+            stream << e.site << '\t'
+                << e.method << '\t'
+                << e.calls << '\t'
+                << e.evaluations << '\t'
+                << e.subdivisions << '\t'
+                << std::setprecision(3) << e.max_error << '\t'
+                << std::setprecision(6) << e.seconds << std::endl;
+        }
+    }
+
+    IntegrationStatistics::Record::Record(const IntegrationSite & site, const char * method) :
+        _site(site),
+        _method(method),
+        _active(IntegrationStatistics::enabled()),
+        _evaluations(0),
+        _subdivisions(0),
+        _error(0.0)
+    {
+        if (_active)
+            _start = std::chrono::steady_clock::now();
+    }
+
+    IntegrationStatistics::Record::~Record()
+    {
+        if (! _active)
+            return;
+
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+
+        IntegrationStatistics::instance()->add(_site, _method, _evaluations, _subdivisions, _error, seconds);
+    }
+
+    const std::function<void (const double *, double *, const std::size_t &)> &
+    IntegrationStatistics::Record::count(const std::function<void (const double *, double *, const std::size_t &)> & f)
+    {
+        using Integrand = std::function<void (const double *, double *, const std::size_t &)>;
+
+        if (! _active)
+            return f;
+
+        auto wrapper = std::make_shared<Integrand>([this, &f] (const double * x, double * y, const std::size_t & n)
+        {
+            _evaluations += n;
+            f(x, y, n);
+        });
+        _wrapper = wrapper;
+
+        return *wrapper;
+    }
+}
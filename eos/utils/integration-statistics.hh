@@ -0,0 +1,203 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_INTEGRATION_STATISTICS_HH
+#define EOS_GUARD_EOS_UTILS_INTEGRATION_STATISTICS_HH 1
+
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <chrono>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Location of a call of a numerical integration routine in the source code.
+     *
+     * All integration routines take an IntegrationSite as their last parameter, which
+     * defaults to the location of their caller.
+     */
+    struct IntegrationSite
+    {
+        const char * file;
+        unsigned line;
+
+#if defined(__GNUC__) || defined(__clang__)
+        IntegrationSite(const char * file = __builtin_FILE(), unsigned line = __builtin_LINE()) :
+#else
+        IntegrationSite(const char * file = "unknown", unsigned line = 0) :
+#endif
+            file(file),
+            line(line)
+        {
+        }
+    };
+
+    /*!
+     * Opt-in statistics of all numerical integrations, aggregated per call site.
+     *
+     * Recording is enabled either by setting the environment variable EOS_INTEGRATION_STATISTICS,
+     * in which case the statistics are written to the standard error stream at process exit,
+     * or by calling enable(). While recording is disabled, each integration only checks a flag.
+     */
+    class IntegrationStatistics :
+        public InstantiationPolicy<IntegrationStatistics, Singleton>,
+        public PrivateImplementationPattern<IntegrationStatistics>
+    {
+        private:
+            ///@name Basic Functions
+            ///@{
+            /// Constructor.
+            IntegrationStatistics();
+            ///@}
+
+        public:
+            friend class InstantiationPolicy<IntegrationStatistics, Singleton>;
+
+            class Record;
+
+            /// Statistics of all integrations at one call site.
+            struct Entry
+            {
+                /// The call site, as 'file:line'.
+                std::string site;
+
+                /// The integration method.
+                std::string method;
+
+                /// The number of integrations.
+                unsigned long calls;
+
+                /// The total number of integrand evaluations.
+                unsigned long evaluations;
+
+                /// The total number of subintervals or subregions, if reported by the method.
+                unsigned long subdivisions;
+
+                /// The largest estimate of the absolute error, if reported by the method.
+                double max_error;
+
+                /// The total wall time in seconds, including the time spent in nested integrations.
+                double seconds;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /// Destructor.
+            ~IntegrationStatistics();
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Return whether integrations are currently recorded.
+            static bool enabled();
+
+            /// Enable or disable the recording of integrations.
+            static void enable(const bool & enabled = true);
+
+            /// Return the statistics of all call sites, ordered by descending wall time.
+            std::vector<Entry> entries() const;
+
+            /// Discard all statistics recorded so far.
+            void reset();
+
+            /// Write the statistics of all call sites as a table to a stream.
+            void dump(std::ostream & stream) const;
+            ///@}
+
+            /// Add the statistics of one integration. Used by Record.
+            void add(const IntegrationSite & site, const char * method, const unsigned long & evaluations,
+                    const unsigned long & subdivisions, const double & error, const double & seconds);
+    };
+
+    /*!
+     * Records a single integration for the duration of its lifetime, if recording is enabled.
+     */
+    class IntegrationStatistics::Record
+    {
+        private:
+            IntegrationSite _site;
+
+            const char * _method;
+
+            bool _active;
+
+            std::chrono::steady_clock::time_point _start;
+
+            unsigned long _evaluations;
+
+            unsigned long _subdivisions;
+
+            double _error;
+
+            // holds the counting wrapper of the integrand
+            std::shared_ptr<void> _wrapper;
+
+        public:
+            Record(const IntegrationSite & site, const char * method);
+
+            ~Record();
+
+            Record(const Record &) = delete;
+            Record & operator= (const Record &) = delete;
+
+            /// Return whether this integration is recorded.
+            bool active() const { return _active; }
+
+            /// Set the number of integrand evaluations, if they are not counted with count().
+            void evaluations(const unsigned long & n) { _evaluations = n; }
+
+            /// Set the number of subintervals or subregions.
+            void subdivisions(const unsigned long & n) { _subdivisions = n; }
+
+            /// Set the estimate of the absolute error.
+            void error(const double & e) { _error = e; }
+
+            /*!
+             * Return an integrand that counts its evaluations, or f itself if this integration is not recorded.
+             *
+             * The returned integrand remains valid for the lifetime of the Record.
+             */
+            template <typename Result_, typename ... Args_>
+            const std::function<Result_ (Args_ ...)> & count(const std::function<Result_ (Args_ ...)> & f)
+            {
+                if (! _active)
+                    return f;
+
+                auto wrapper = std::make_shared<std::function<Result_ (Args_ ...)>>([this, &f] (Args_ ... args) -> Result_
+                {
+                    ++_evaluations;
+                    return f(std::forward<Args_>(args) ...);
+                });
+                _wrapper = wrapper;
+
+                return *wrapper;
+            }
+
+            /// As above, for vectorised integrands of one or more variables that are evaluated at n points per call.
+            const std::function<void (const double *, double *, const std::size_t &)> & count(const std::function<void (const double *, double *, const std::size_t &)> & f);
+    };
+}
+
+#endif
@@ -18,10 +18,32 @@
 
 #include <eos/utils/memoise.hh>
 
+#include <algorithm>
+
 namespace eos
 {
+    constexpr unsigned MemoisationControl::default_capacity;
+
+    void
+    implementation::MemoiserRegistry::add(MemoiserBase * memoiser)
+    {
+        Lock l(mutex);
+
+        memoisers.push_back(memoiser);
+    }
+
+    void
+    implementation::MemoiserRegistry::remove(MemoiserBase * memoiser)
+    {
+        Lock l(mutex);
+
+        memoisers.erase(std::remove(memoisers.begin(), memoisers.end(), memoiser), memoisers.end());
+    }
+
     MemoisationControl::MemoisationControl() :
-        _mutex(new Mutex)
+        _mutex(new Mutex),
+        _registry(new implementation::MemoiserRegistry),
+        _capacity(default_capacity)
     {
     }
 
@@ -38,6 +60,12 @@ namespace eos
         _clear_functions.push_back(clear_function);
     }
 
+    std::shared_ptr<implementation::MemoiserRegistry>
+    MemoisationControl::registry() const
+    {
+        return _registry;
+    }
+
     void
     MemoisationControl::clear()
     {
@@ -47,5 +75,48 @@ namespace eos
         {
             (*c)();
         }
+
+        Lock r(_registry->mutex);
+        for (auto & m : _registry->memoisers)
+        {
+            m->clear();
+        }
+    }
+
+    unsigned
+    MemoisationControl::capacity() const
+    {
+        Lock l(*_mutex);
+
+        return _capacity;
+    }
+
+    void
+    MemoisationControl::set_capacity(const unsigned & capacity)
+    {
+        Lock l(*_mutex);
+
+        _capacity = capacity;
+
+        Lock r(_registry->mutex);
+        for (auto & m : _registry->memoisers)
+        {
+            m->set_capacity(capacity);
+        }
+    }
+
+    MemoiserBase::Statistics
+    MemoisationControl::statistics() const
+    {
+        Lock l(*_mutex);
+        Lock r(_registry->mutex);
+
+        MemoiserBase::Statistics result;
+        for (const auto & m : _registry->memoisers)
+        {
+            result += m->statistics();
+        }
+
+        return result;
     }
 }
@@ -26,73 +26,330 @@
 #include <eos/utils/lock.hh>
 #include <eos/utils/mutex.hh>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <memory>
 #include <tuple>
-#include <unordered_map>
 #include <vector>
 
-/* We are using a custom std::hash for tuple<FunctionPtr, double, ..., double> */
-namespace std
+namespace eos
 {
-    template <typename U_> static uint64_t __hash_one(const U_ & u)
+    namespace implementation
     {
-        static_assert(sizeof(U_) == sizeof(uint32_t) || sizeof(U_) == sizeof(uint64_t), "Need to specialize __hash_one for non 32- and 64-bit data types");
+        template <typename T_> struct ResultOf;
 
-        if (sizeof(U_) == sizeof(int64_t))
+        template <typename Result_, typename Class_, typename ... Args_>
+        struct ResultOf<Result_ (Class_::*) (Args_ ...)>
         {
-            return *reinterpret_cast<const uint64_t *>(&u);
-        }
-        else if (sizeof(U_) == sizeof(uint32_t))
+            using Type = Result_;
+        };
+
+        template <typename Result_, typename ... Args_>
+        struct ResultOf<Result_ (*) (Args_ ...)>
         {
-            return static_cast<const uint64_t>(*reinterpret_cast<const uint32_t *>(&u));
-        }
-    }
+            using Type = Result_;
+        };
 
-    template <unsigned n_, typename ... T_>
-    struct __TupleHasher
-    {
-        static uint64_t hash(const std::tuple<T_ ...> & t)
+        /// Finalisation step of MurmurHash3, mixing all input bits into all output bits.
+        inline uint64_t mix_bits(uint64_t h)
         {
-            return __TupleHasher<n_ - 1, T_ ...>::hash(t) ^ __hash_one<decltype(std::get<n_>(t))>(std::get<n_>(t));
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+
+            return h;
         }
-    };
 
-    template <typename ... T_>
-    struct __TupleHasher<0, T_ ...>
-    {
-        static uint64_t hash(const std::tuple<T_ ...> & t)
+        /// Raw bit representation of a 32- or 64-bit value, e.g. a double or a function pointer.
+        template <typename U_> uint64_t raw_bits(const U_ & u)
         {
-            return __hash_one<decltype(std::get<0>(t))>(std::get<0>(t));
+            static_assert(sizeof(U_) == sizeof(uint32_t) || sizeof(U_) == sizeof(uint64_t), "Need to specialize raw_bits for non 32- and 64-bit data types");
+
+            if (sizeof(U_) == sizeof(uint64_t))
+            {
+                uint64_t result;
+                std::memcpy(&result, &u, sizeof(uint64_t));
+
+                return result;
+            }
+            else
+            {
+                uint32_t result;
+                std::memcpy(&result, &u, sizeof(uint32_t));
+
+                return result;
+            }
         }
-    };
 
-    template <typename ... T_>
-    struct hash<std::tuple<T_ ...>>
-    {
-        size_t operator() (const std::tuple<T_ ...> & t) const
+        /*!
+         * Hash for tuple<FunctionPtr, double, ..., double>.
+         *
+         * Each element is mixed into the running hash, such that permuted or
+         * correlated arguments with similar bit patterns yield distinct hashes.
+         */
+        template <typename ... T_>
+        struct TupleHash
         {
-            return __TupleHasher<sizeof...(T_) - 1, T_ ...>::hash(t);
-        }
-    };
-}
+            template <std::size_t n_>
+            static uint64_t combine(const std::tuple<T_ ...> &, uint64_t h, std::integral_constant<std::size_t, n_>, std::true_type)
+            {
+                return h;
+            }
 
-namespace eos
-{
-    namespace implementation
-    {
-        template <typename T_> struct ResultOf;
+            template <std::size_t n_>
+            static uint64_t combine(const std::tuple<T_ ...> & t, uint64_t h, std::integral_constant<std::size_t, n_>, std::false_type)
+            {
+                h = mix_bits(h ^ (raw_bits(std::get<n_>(t)) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2)));
 
-        template <typename Result_, typename Class_, typename ... Args_>
-        struct ResultOf<Result_ (Class_::*) (Args_ ...)>
+                return combine(t, h, std::integral_constant<std::size_t, n_ + 1>(), std::integral_constant<bool, n_ + 1 == sizeof...(T_)>());
+            }
+
+            uint64_t operator() (const std::tuple<T_ ...> & t) const
+            {
+                return combine(t, sizeof...(T_), std::integral_constant<std::size_t, 0>(), std::integral_constant<bool, 0 == sizeof...(T_)>());
+            }
+        };
+
+        /*!
+         * Open-addressing hash table with linear probing, used as the memoisation store.
+         *
+         * Entries live in a single contiguous array of slots. The table grows up to
+         * twice its capacity. Beyond the capacity, entries are evicted following
+         * the CLOCK algorithm, an approximation of least-recently-used eviction:
+         * a lookup marks the entry as referenced, and the clock hand evicts the
+         * first entry that has not been referenced since its last sweep.
+         *
+         * Not thread safe; the caller needs to provide synchronisation.
+         */
+        template <typename Key_, typename Value_>
+        class FlatMemoisationTable
         {
-            using Type = Result_;
+            private:
+                struct Slot
+                {
+                    Key_ key;
+                    Value_ value;
+                    uint64_t hash;
+                    bool occupied = false;
+                    bool referenced = false;
+                };
+
+                std::vector<Slot> _slots;
+
+                std::size_t _size;
+
+                std::size_t _hand;
+
+                unsigned long _evictions;
+
+                std::size_t mask() const
+                {
+                    return _slots.size() - 1u;
+                }
+
+                // Remove the entry in slot i, moving subsequent entries of the probe sequence into the gap.
+                void erase_at(std::size_t i)
+                {
+                    for (std::size_t k = (i + 1u) & mask() ; _slots[k].occupied ; k = (k + 1u) & mask())
+                    {
+                        // an entry whose home slot lies cyclically within (i, k] must stay where it is
+                        std::size_t home = _slots[k].hash & mask();
+                        bool stays = (i <= k) ? ((i < home) && (home <= k)) : ((i < home) || (home <= k));
+                        if (stays)
+                            continue;
+
+                        _slots[i] = std::move(_slots[k]);
+                        i = k;
+                    }
+
+                    _slots[i].occupied = false;
+                    _slots[i].referenced = false;
+                    --_size;
+                }
+
+                void evict_one()
+                {
+                    while (true)
+                    {
+                        _hand = (_hand + 1u) & mask();
+                        Slot & slot = _slots[_hand];
+
+                        if (! slot.occupied)
+                            continue;
+
+                        if (slot.referenced)
+                        {
+                            slot.referenced = false;
+                            continue;
+                        }
+
+                        erase_at(_hand);
+                        ++_evictions;
+
+                        return;
+                    }
+                }
+
+                void place(Slot && slot)
+                {
+                    std::size_t i = slot.hash & mask();
+                    while (_slots[i].occupied)
+                    {
+                        i = (i + 1u) & mask();
+                    }
+
+                    _slots[i] = std::move(slot);
+                    ++_size;
+                }
+
+                void grow()
+                {
+                    std::vector<Slot> old(2u * _slots.size());
+                    std::swap(old, _slots);
+                    _size = 0;
+                    _hand = 0;
+
+                    for (auto & slot : old)
+                    {
+                        if (slot.occupied)
+                            place(std::move(slot));
+                    }
+                }
+
+            public:
+                FlatMemoisationTable() :
+                    _slots(16u),
+                    _size(0),
+                    _hand(0),
+                    _evictions(0)
+                {
+                }
+
+                /// Look up a key, returning nullptr if it is not present.
+                const Value_ * find(const Key_ & key, const uint64_t & hash)
+                {
+                    for (std::size_t i = hash & mask() ; _slots[i].occupied ; i = (i + 1u) & mask())
+                    {
+                        Slot & slot = _slots[i];
+                        if ((slot.hash == hash) && (slot.key == key))
+                        {
+                            slot.referenced = true;
+
+                            return &slot.value;
+                        }
+                    }
+
+                    return nullptr;
+                }
+
+                /// Insert a key that is not yet present, evicting entries to respect the capacity.
+                void insert(const Key_ & key, const uint64_t & hash, const Value_ & value, const std::size_t & capacity)
+                {
+                    shrink(capacity > 0u ? capacity - 1u : 0u);
+
+                    if (2u * (_size + 1u) > _slots.size())
+                        grow();
+
+                    Slot slot;
+                    slot.key = key;
+                    slot.value = value;
+                    slot.hash = hash;
+                    slot.occupied = true;
+                    place(std::move(slot));
+                }
+
+                /// Evict entries until at most capacity of them remain.
+                void shrink(const std::size_t & capacity)
+                {
+                    while (_size > capacity)
+                    {
+                        evict_one();
+                    }
+                }
+
+                void clear()
+                {
+                    _slots = std::vector<Slot>(16u);
+                    _size = 0;
+                    _hand = 0;
+                }
+
+                std::size_t size() const
+                {
+                    return _size;
+                }
+
+                unsigned long evictions() const
+                {
+                    return _evictions;
+                }
         };
+    }
 
-        template <typename Result_, typename ... Args_>
-        struct ResultOf<Result_ (*) (Args_ ...)>
+    /*!
+     * Common interface of all memoisers, used by MemoisationControl to
+     * manage the memoisers of all function signatures at once.
+     */
+    class MemoiserBase
+    {
+        public:
+            /// Usage statistics of a memoiser.
+            struct Statistics
+            {
+                /// Number of lookups that were answered from the memoisation store.
+                unsigned long hits = 0;
+
+                /// Number of lookups that required to evaluate the function.
+                unsigned long misses = 0;
+
+                /// Number of memoisations that were discarded to respect the capacity.
+                unsigned long evictions = 0;
+
+                Statistics & operator+= (const Statistics & other)
+                {
+                    hits      += other.hits;
+                    misses    += other.misses;
+                    evictions += other.evictions;
+
+                    return *this;
+                }
+            };
+
+            virtual ~MemoiserBase() = default;
+
+            /// Remove all memoisations.
+            virtual void clear() = 0;
+
+            /// Change the maximal number of memoisations, evicting the least recently used ones if necessary.
+            virtual void set_capacity(const unsigned & capacity) = 0;
+
+            /// Retrieve the current usage statistics.
+            virtual Statistics statistics() const = 0;
+    };
+
+    namespace implementation
+    {
+        /*!
+         * The set of all existing memoisers.
+         *
+         * It is co-owned by MemoisationControl and by every memoiser, so that memoisers
+         * which are destroyed after MemoisationControl can still unregister safely.
+         */
+        struct MemoiserRegistry
         {
-            using Type = Result_;
+            Mutex mutex;
+
+            std::vector<MemoiserBase *> memoisers;
+
+            void add(MemoiserBase * memoiser);
+
+            void remove(MemoiserBase * memoiser);
         };
     }
 
@@ -104,18 +361,51 @@ namespace eos
 
             std::vector<std::function<void ()>> _clear_functions;
 
+            std::shared_ptr<implementation::MemoiserRegistry> _registry;
+
+            unsigned _capacity;
+
         public:
+            /// Default maximal number of memoisations per memoiser.
+            static constexpr unsigned default_capacity = 100000u;
+
             MemoisationControl();
 
             ~MemoisationControl();
 
             void register_clear_function(const std::function<void ()> & clear_function);
 
+            /// Retrieve the registry with which each memoiser registers itself.
+            std::shared_ptr<implementation::MemoiserRegistry> registry() const;
+
             void clear();
+
+            /// Retrieve the maximal number of memoisations per memoiser.
+            unsigned capacity() const;
+
+            /*!
+             * Change the maximal number of memoisations per memoiser.
+             *
+             * Applies to all existing and future memoisers.
+             */
+            void set_capacity(const unsigned & capacity);
+
+            /// Retrieve the usage statistics accumulated over all memoisers.
+            MemoiserBase::Statistics statistics() const;
     };
 
+    /*!
+     * Memoiser for functions of a given signature.
+     *
+     * The memoisations are distributed over a fixed number of shards, each
+     * protected by its own mutex. Concurrent lookups therefore only contend
+     * if they hit the same shard. The function is evaluated outside of any lock.
+     * Once a shard exceeds its share of the capacity, memoisations are evicted
+     * using the CLOCK approximation of least-recently-used eviction.
+     */
     template <typename Result_, typename ... Params_>
     class Memoiser :
+        public MemoiserBase,
         public InstantiationPolicy<Memoiser<Result_, Params_ ...>, Singleton>
     {
         public:
@@ -123,56 +413,138 @@ namespace eos
             using KeyType = std::tuple<FunctionType, Params_...>;
 
         private:
-            Mutex * const _mutex;
+            static constexpr unsigned number_of_shards = 16u;
 
-            std::unordered_map<KeyType, Result_> _memoisations;
+            using TableType = implementation::FlatMemoisationTable<KeyType, Result_>;
+
+            struct Shard
+            {
+                mutable Mutex mutex;
+
+                TableType table;
+            };
+
+            std::array<Shard, number_of_shards> _shards;
+
+            std::atomic<unsigned> _shard_capacity;
+
+            std::atomic<unsigned long> _hits;
+
+            std::atomic<unsigned long> _misses;
+
+            // Function-local static memoisers can outlive MemoisationControl; keep the registry alive.
+            const std::shared_ptr<implementation::MemoiserRegistry> _registry;
+
+            static unsigned shard_capacity(const unsigned & capacity)
+            {
+                return std::max(1u, (capacity + number_of_shards - 1u) / number_of_shards);
+            }
+
+            // The table uses the low bits of the hash, so select the shard using the high bits.
+            Shard & shard(const uint64_t & hash)
+            {
+                return _shards[hash >> 60];
+            }
 
         public:
             Memoiser() :
-                _mutex(new Mutex)
+                _shard_capacity(shard_capacity(MemoisationControl::instance()->capacity())),
+                _hits(0),
+                _misses(0),
+                _registry(MemoisationControl::instance()->registry())
             {
-                MemoisationControl::instance()->register_clear_function(std::bind(&Memoiser<Result_, Params_ ...>::clear, this));
+                _registry->add(this);
             }
 
             ~Memoiser()
             {
-                delete _mutex;
+                _registry->remove(this);
             }
 
             Result_ operator() (const FunctionType & f, const Params_ & ... p)
             {
-                Lock l(*_mutex);
-
                 KeyType key(f, p ...);
-                auto i = _memoisations.find(key);
+                const uint64_t hash = implementation::TupleHash<FunctionType, Params_ ...>()(key);
+                Shard & s = shard(hash);
+
+                {
+                    Lock l(s.mutex);
+
+                    const Result_ * memoised = s.table.find(key, hash);
+                    if (memoised)
+                    {
+                        ++_hits;
 
-                if (_memoisations.end() != i)
-                    return i->second;
+                        return *memoised;
+                    }
+                }
 
+                ++_misses;
                 Result_ result = f(p ...);
 
-                if (_memoisations.size() > 100000u)
                 {
-                    _memoisations.clear();
-                }
+                    Lock l(s.mutex);
+
+                    // another thread might have memoised the same key in the meantime
+                    if (s.table.find(key, hash))
+                        return result;
 
-                _memoisations.insert(std::pair<KeyType, Result_>(key, result));
+                    s.table.insert(key, hash, result, _shard_capacity.load());
+                }
 
                 return result;
             }
 
-            void clear()
+            virtual void clear()
             {
-                Lock l(*_mutex);
+                for (auto & s : _shards)
+                {
+                    Lock l(s.mutex);
 
-                _memoisations.clear();
+                    s.table.clear();
+                }
+            }
+
+            virtual void set_capacity(const unsigned & capacity)
+            {
+                _shard_capacity = shard_capacity(capacity);
+
+                for (auto & s : _shards)
+                {
+                    Lock l(s.mutex);
+
+                    s.table.shrink(_shard_capacity.load());
+                }
+            }
+
+            virtual Statistics statistics() const
+            {
+                Statistics result;
+                result.hits   = _hits.load();
+                result.misses = _misses.load();
+
+                for (auto & s : _shards)
+                {
+                    Lock l(s.mutex);
+
+                    result.evictions += s.table.evictions();
+                }
+
+                return result;
             }
 
             unsigned number_of_memoisations() const
             {
-                Lock l(*_mutex);
+                unsigned result = 0;
 
-                return _memoisations.size();
+                for (auto & s : _shards)
+                {
+                    Lock l(s.mutex);
+
+                    result += s.table.size();
+                }
+
+                return result;
             }
     };
 
@@ -0,0 +1,86 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/memoise.hh>
+
+#include <chrono>
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+/*
+ * Measure the cost of memoised lookups.
+ *
+ * Build with 'make memoise_BENCHMARK' and run without arguments.
+ */
+
+using namespace eos;
+
+namespace
+{
+    // same signature as CharmLoops::F27_massive and friends
+    std::complex<double> f(const double & mu, const double & s, const double & m_b, const double & m_c)
+    {
+        return std::complex<double>(mu * s, m_b * m_c);
+    }
+}
+
+int main(int, char **)
+{
+    using Key = std::tuple<decltype(&f), double, double, double, double>;
+
+    // key shapes as used in the integrated observables of B->K^*ll at large recoil:
+    // a fixed renormalisation scale, the q^2 abscissae of the integration, and a
+    // handful of quark masses
+    std::vector<Key> keys;
+    for (double mu : { 4.2, 2.1, 8.4 })
+    {
+        for (double m_c : { 1.3, 1.4, 1.5, 1.6 })
+        {
+            for (unsigned i = 0 ; i <= 64 ; ++i)
+            {
+                keys.emplace_back(&f, mu, 1.0 + 5.0 * i / 64.0, 4.6, m_c);
+            }
+        }
+    }
+
+    for (const auto & key : keys)
+    {
+        memoise(f, std::get<1>(key), std::get<2>(key), std::get<3>(key), std::get<4>(key));
+    }
+
+    static const unsigned rounds = 200;
+    double sum = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned r = 0 ; r < rounds ; ++r)
+    {
+        for (const auto & key : keys)
+        {
+            sum += real(memoise(f, std::get<1>(key), std::get<2>(key), std::get<3>(key), std::get<4>(key)));
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / (rounds * keys.size());
+    std::cout << "# memoised lookup of " << keys.size() << " charm-loop keys: " << ns << " ns (checksum " << sum << ")" << std::endl;
+
+    return EXIT_SUCCESS;
+}
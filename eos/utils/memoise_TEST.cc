@@ -21,6 +21,8 @@
 #include <eos/utils/memoise.hh>
 
 #include <complex>
+#include <set>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -104,5 +106,98 @@ class MemoiseTest :
                 TEST_CHECK_EQUAL(0, number_of_memoisations(f1, 0.0, 0.0));
                 TEST_CHECK_EQUAL(0, number_of_memoisations(f2, 0.0, 0.0));
             }
+
+            /* Test statistics */
+            {
+                const MemoiserBase::Statistics initial = MemoisationControl::instance()->statistics();
+
+                TEST_CHECK_EQUAL(0.5, memoise(f1, 1.0, 2.0));
+                TEST_CHECK_EQUAL(0.5, memoise(f1, 1.0, 2.0));
+                TEST_CHECK_EQUAL(0.5, memoise(f1, 1.0, 2.0));
+
+                const MemoiserBase::Statistics final = MemoisationControl::instance()->statistics();
+                TEST_CHECK_EQUAL(initial.misses + 1, final.misses);
+                TEST_CHECK_EQUAL(initial.hits + 2,   final.hits);
+
+                MemoisationControl::instance()->clear();
+            }
+
+            /* Test bounded capacity */
+            {
+                for (unsigned i = 0 ; i < 1000 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(i / 2.0, memoise(f1, double(i), 2.0));
+                }
+                TEST_CHECK_EQUAL(1000, number_of_memoisations(f1, 0.0, 0.0));
+
+                // shrinking the capacity evicts existing memoisations
+                MemoisationControl::instance()->set_capacity(16);
+                TEST_CHECK_EQUAL(16u, MemoisationControl::instance()->capacity());
+                TEST_CHECK(number_of_memoisations(f1, 0.0, 0.0) <= 16);
+
+                for (unsigned i = 1000 ; i < 2000 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(i / 2.0, memoise(f1, double(i), 2.0));
+                }
+                TEST_CHECK(number_of_memoisations(f1, 0.0, 0.0) <= 16);
+                TEST_CHECK(number_of_memoisations(f1, 0.0, 0.0) > 0);
+                TEST_CHECK(MemoisationControl::instance()->statistics().evictions >= 2000 - 16);
+
+                // the most recent memoisation survives
+                const unsigned long misses = MemoisationControl::instance()->statistics().misses;
+                TEST_CHECK_EQUAL(1999 / 2.0, memoise(f1, 1999.0, 2.0));
+                TEST_CHECK_EQUAL(misses, MemoisationControl::instance()->statistics().misses);
+
+                MemoisationControl::instance()->set_capacity(MemoisationControl::default_capacity);
+                MemoisationControl::instance()->clear();
+            }
         }
 } memoise_test;
+
+class MemoiseHashTest :
+    public TestCase
+{
+    public:
+        MemoiseHashTest() :
+            TestCase("memoise_hash_test")
+        {
+        }
+
+        // same signature as CharmLoops::F27_massive and friends
+        static std::complex<double> f(const double & mu, const double & s, const double & m_b, const double & m_c)
+        {
+            return std::complex<double>(mu * s, m_b * m_c);
+        }
+
+        virtual void run() const
+        {
+            using Key = std::tuple<decltype(&f), double, double, double, double>;
+            using Hash = implementation::TupleHash<decltype(&f), double, double, double, double>;
+
+            // key shapes as used in the integrated observables of B->K^*ll at large recoil:
+            // a fixed renormalisation scale, the q^2 abscissae of the integration, and a
+            // handful of quark masses
+            std::vector<Key> keys;
+            for (double mu : { 4.2, 2.1, 8.4 })
+            {
+                for (double m_c : { 1.3, 1.4, 1.5, 1.6 })
+                {
+                    for (unsigned i = 0 ; i <= 64 ; ++i)
+                    {
+                        keys.emplace_back(&f, mu, 1.0 + 5.0 * i / 64.0, 4.6, m_c);
+                    }
+                }
+            }
+
+            // the hash must distinguish all keys, including those with swapped arguments
+            std::set<uint64_t> hashes;
+            for (const auto & key : keys)
+            {
+                hashes.insert(Hash()(key));
+            }
+            TEST_CHECK_EQUAL(keys.size(), hashes.size());
+
+            TEST_CHECK(Hash()(Key(&f, 4.2, 1.0, 4.6, 1.4)) != Hash()(Key(&f, 4.2, 1.0, 1.4, 4.6)));
+            TEST_CHECK(Hash()(Key(&f, 2.0, 2.0, 4.6, 1.4)) != Hash()(Key(&f, 4.0, 4.0, 4.6, 1.4)));
+        }
+} memoise_hash_test;
@@ -56,14 +56,27 @@ namespace eos
         // Contains each cacheable observable and its associated index
         std::multimap<std::type_index, std::tuple<CacheableObservable *, ObservableCache::Id>> cacheable_observables;
 
-        // Contains each cached observables and its associated index
-        std::vector<std::tuple<ObservablePtr, ObservableCache::Id>> cached_observables;
+        // Contains each cached observables, its associated index, and the index of the cacheable observable it draws from
+        std::vector<std::tuple<ObservablePtr, ObservableCache::Id, ObservableCache::Id>> cached_observables;
 
         // Contains values of all observables
         std::vector<double> predictions;
 
+        // Contains the ids of the parameters used by each observable
+        std::vector<std::vector<Parameter::Id>> used_ids;
+
+        // Contains the values of the kinematic variables of each observable at the last update
+        std::vector<std::vector<double>> kinematic_values;
+
+        // Contains whether or not an observable needs to be reevaluated
+        std::vector<char> stale;
+
+        // Generation of the parameters at the last update
+        Parameters::Generation generation;
+
         Implementation(const Parameters & parameters) :
-            parameters(parameters)
+            parameters(parameters),
+            generation(parameters.generation())
         {
         }
 
@@ -94,6 +107,98 @@ namespace eos
             return true;
         }
 
+        void record_used_ids(const Observable & observable)
+        {
+            std::vector<Parameter::Id> ids;
+            for (auto i = observable.begin(), i_end = observable.end() ; i != i_end ; ++i)
+            {
+                ids.push_back(*i);
+            }
+
+            used_ids.push_back(std::move(ids));
+            kinematic_values.push_back(std::vector<double>());
+            stale.push_back(true);
+        }
+
+        // Record the current values of the observable's kinematic variables.
+        // Returns true if any of them changed since the last call.
+        bool record_kinematic_values(const unsigned & idx)
+        {
+            const Kinematics kinematics = observables[idx]->kinematics();
+            std::vector<double> & values = kinematic_values[idx];
+
+            bool result = false;
+            unsigned k = 0;
+            for (auto v = kinematics.begin(), v_end = kinematics.end() ; v != v_end ; ++v, ++k)
+            {
+                const double value = v->evaluate();
+
+                if (k == values.size())
+                {
+                    values.push_back(value);
+                    result = true;
+                }
+                else if (values[k] != value)
+                {
+                    values[k] = value;
+                    result = true;
+                }
+            }
+
+            return result;
+        }
+
+        // Mark all observables that depend on parameters or kinematic variables changed since
+        // the last update as stale. Returns true if at least one observable is stale.
+        bool mark_stale_observables()
+        {
+            const Parameters::Generation current = parameters.generation();
+
+            bool result = false;
+            for (unsigned idx = 0 ; idx < observables.size() ; ++idx)
+            {
+                // the kinematic variables are not tracked by generations, hence compare their values
+                const bool kinematics_changed = record_kinematic_values(idx);
+
+                if (stale[idx])
+                {
+                    result = true;
+                    continue;
+                }
+
+                if (kinematics_changed || used_ids[idx].empty())
+                {
+                    stale[idx] = true;
+                    result = true;
+                    continue;
+                }
+
+                if (current == generation)
+                    continue;
+
+                for (const auto & id : used_ids[idx])
+                {
+                    if (parameters.generation(id) > generation)
+                    {
+                        stale[idx] = true;
+                        result = true;
+                        break;
+                    }
+                }
+            }
+
+            generation = current;
+
+            // cached observables draw from the intermediate results of their cacheable observable
+            for (const auto & co : cached_observables)
+            {
+                if (stale[std::get<2>(co)])
+                    stale[std::get<1>(co)] = true;
+            }
+
+            return result;
+        }
+
         ObservableCache::Id add(const ObservablePtr & observable)
         {
             if (observable->parameters() != parameters)
@@ -133,7 +238,8 @@ namespace eos
                     // add the newly created cached observable
                     observables.push_back(cached_observable);
                     predictions.push_back(std::numeric_limits<double>::quiet_NaN());
-                    cached_observables.push_back(std::make_tuple(cached_observable, index));
+                    record_used_ids(*cached_observable);
+                    cached_observables.push_back(std::make_tuple(cached_observable, index, std::get<1>(c->second)));
 
                     return index;
                 }
@@ -141,6 +247,7 @@ namespace eos
                 // else add this new cacheable observable
                 observables.push_back(observable);
                 predictions.push_back(std::numeric_limits<double>::quiet_NaN());
+                record_used_ids(*observable);
                 cacheable_observables.insert(std::make_pair(type_index, std::make_tuple(cacheable_observable, index)));
 
                 return index;
@@ -150,6 +257,7 @@ namespace eos
                 // add this new regular observable
                 observables.push_back(observable);
                 predictions.push_back(std::numeric_limits<double>::quiet_NaN());
+                record_used_ids(*observable);
                 regular_observables.push_back(std::make_tuple(observable, index));
 
                 return index;
@@ -177,27 +285,26 @@ namespace eos
     void
     ObservableCache::update()
     {
-#ifdef EOS_ENABLE_PMC
-        // evaluate all observables serially
-        auto p = _imp->predictions.begin();
+        // skip the update entirely if no parameter or kinematic variable used by any observable has changed
+        if (! _imp->mark_stale_observables())
+            return;
 
-        for (auto o = _imp->observables.begin(), o_end = _imp->observables.end() ; o != o_end ; ++o, ++p)
-        {
-            *p = (*o)->evaluate();
-        }
-#else
-        // parallelize the evaluation of the observables
-        // since the EOS builtin PMC sampler is parallelized,
-        // parallelizing the ObservableCache can and will lead
-        // to a deadlock.
+        const auto & stale = _imp->stale;
+
+        // parallelize the evaluation of the observables; this is also safe
+        // within jobs of the ThreadPool, e.g. within the workers of the PMC
+        // sampler, since waiting for a ticket executes pending jobs.
 
         std::vector<Ticket> cacheable_tickets;
         cacheable_tickets.reserve(_imp->cacheable_observables.size());
 
-        // evaluate all cacheable observables in parallel
-        for (auto co : _imp->cacheable_observables)
+        // evaluate all stale cacheable observables in parallel
+        for (const auto & co : _imp->cacheable_observables)
         {
-            auto f = [=]() {
+            if (! stale[std::get<1>(co.second)])
+                continue;
+
+            auto f = [this, &co]() {
                 auto & o   = std::get<0>(co.second);
                 auto & idx = std::get<1>(co.second);
                 try
@@ -213,16 +320,19 @@ namespace eos
 
                 }
             };
-            cacheable_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+            cacheable_tickets.push_back(ThreadPool::instance()->enqueue(f));
         }
 
         std::vector<Ticket> regular_tickets;
         regular_tickets.reserve(_imp->regular_observables.size());
 
-        // evaluate all regular observables in parallel
-        for (auto ro : _imp->regular_observables)
+        // evaluate all stale regular observables in parallel
+        for (const auto & ro : _imp->regular_observables)
         {
-            auto f = [=]() {
+            if (! stale[std::get<1>(ro)])
+                continue;
+
+            auto f = [this, &ro]() {
                 auto & o   = std::get<0>(ro);
                 auto & idx = std::get<1>(ro);
                 try
@@ -238,7 +348,7 @@ namespace eos
 
                 }
             };
-            regular_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+            regular_tickets.push_back(ThreadPool::instance()->enqueue(f));
         }
 
         // await completion of the cacheable observables
@@ -250,10 +360,13 @@ namespace eos
         std::vector<Ticket> cached_tickets;
         cached_tickets.reserve(_imp->cached_observables.size());
 
-        // evaluate all cached observables in parallel
-        for (auto co : _imp->cached_observables)
+        // evaluate all stale cached observables in parallel
+        for (const auto & co : _imp->cached_observables)
         {
-            auto f = [=]() {
+            if (! stale[std::get<1>(co)])
+                continue;
+
+            auto f = [this, &co]() {
                 auto & o   = std::get<0>(co);
                 auto & idx = std::get<1>(co);
                 try
@@ -269,7 +382,7 @@ namespace eos
 
                 }
             };
-            cached_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+            cached_tickets.push_back(ThreadPool::instance()->enqueue(f));
         }
 
         // await completion of the regular observables
@@ -283,7 +396,8 @@ namespace eos
         {
             ticket.wait();
         }
-#endif
+
+        std::fill(_imp->stale.begin(), _imp->stale.end(), false);
     }
 
     Parameters
@@ -298,6 +412,12 @@ namespace eos
         return _imp->predictions[id];
     }
 
+    const double *
+    ObservableCache::predictions() const
+    {
+        return _imp->predictions.data();
+    }
+
     ObservablePtr
     ObservableCache::observable(const ObservableCache::Id & id) const
     {
@@ -56,7 +56,14 @@ namespace eos
              */
             Id add(const ObservablePtr & observable);
 
-            /// Update the predictions for all observables.
+            /*!
+             * Update the predictions for all observables.
+             *
+             * Observables that do not use any parameter whose value has changed
+             * since the last update, and whose kinematic variables are unchanged,
+             * retain their previous prediction. Observables that do not declare
+             * any used parameters are always reevaluated.
+             */
             void update();
 
             /// Retrieve the cache's common Parameters object.
@@ -76,6 +83,13 @@ namespace eos
              */
             double operator[] (const ObservableCache::Id & id) const;
 
+            /*!
+             * Retrieve the predictions for all observables, indexed by their ObservableCache::Id.
+             *
+             * @note The pointer is invalidated when an observable is added to the cache.
+             */
+            const double * predictions() const;
+
             /// Retrieve the number of independent predictions from the cache.
             unsigned size() const;
 
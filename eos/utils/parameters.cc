@@ -183,14 +183,14 @@ namespace eos
     struct Parameter::Data :
         Parameter::Template
     {
-        double value;
-
         Parameter::Id id;
 
+        Parameters::Generation generation;
+
         Data(const Parameter::Template & t, const Parameter::Id & i) :
             Parameter::Template(t),
-            value(t.central),
-            id(i)
+            id(i),
+            generation(0)
         {
         }
     };
@@ -198,6 +198,51 @@ namespace eos
     struct Parameters::Data
     {
         std::vector<Parameter::Data> data;
+
+        // numeric values of all parameters, stored contiguously for fast access through ParameterHandle
+        std::vector<double> values;
+
+        Parameters::Generation generation = 0;
+
+        inline void push_back(const Parameter::Data & d)
+        {
+            data.push_back(d);
+            values.push_back(d.central);
+        }
+
+        inline void set(const unsigned & index, const double & value)
+        {
+            auto & v = values[index];
+
+            // only changes of the numeric value advance the generation
+            if (v == value)
+                return;
+
+            v = value;
+            data[index].generation = ++generation;
+        }
+
+        inline void set_many(const unsigned * indices, const double * new_values, const std::size_t & n)
+        {
+            const Parameters::Generation next = generation + 1;
+            bool changed = false;
+
+            for (std::size_t i = 0 ; i < n ; ++i)
+            {
+                auto & v = values[indices[i]];
+
+                if (v == new_values[i])
+                    continue;
+
+                v = new_values[i];
+                data[indices[i]].generation = next;
+                changed = true;
+            }
+
+            // all changes share a single generation
+            if (changed)
+                generation = next;
+        }
     };
 
     template <>
@@ -231,7 +276,7 @@ namespace eos
             unsigned idx(0);
             for (auto i(list.begin()), i_end(list.end()) ; i != i_end ; ++i, ++idx)
             {
-                parameters_data->data.push_back(Parameter::Data(*i, idx));
+                parameters_data->push_back(Parameter::Data(*i, idx));
                 parameters_map[i->name] = idx;
                 parameters.push_back(Parameter(parameters_data, idx));
             }
@@ -242,7 +287,7 @@ namespace eos
             parameters_map(other.parameters_map)
         {
             parameters.reserve(other.parameters.size());
-            for (unsigned i = 0 ; i != parameters.size() ; ++i)
+            for (unsigned i = 0 ; i != other.parameters.size() ; ++i)
             {
                 parameters.push_back(Parameter(parameters_data, i));
             }
@@ -320,7 +365,7 @@ namespace eos
                         Log::instance()->message("[parameters.override]", ll_informational)
                             << "Overriding existing parameter '" << name << "' with central value '" << central << "'";
 
-                        parameters_data->data[i->second].value = central;
+                        parameters_data->set(i->second, central);
                         if (has_min)
                         {
                             parameters_data->data[i->second].min = min;
@@ -349,7 +394,7 @@ namespace eos
                         }
 
                         auto idx = parameters_data->data.size();
-                        parameters_data->data.push_back(Parameter::Data(Parameter::Template { name, min, central, max, latex }, idx));
+                        parameters_data->push_back(Parameter::Data(Parameter::Template { name, min, central, max, latex }, idx));
                         parameters_map[name] = idx;
                         parameters.push_back(Parameter(parameters_data, idx));
                     }
@@ -497,7 +542,7 @@ namespace eos
                                 throw ParameterInputDuplicateError(file, name);
                             }
 
-                            parameters_data->data.push_back(Parameter::Data(Parameter::Template { name, min, central, max, latex }, idx));
+                            parameters_data->push_back(Parameter::Data(Parameter::Template { name, min, central, max, latex }, idx));
                             parameters_map[name] = idx;
                             parameters.push_back(Parameter(parameters_data, idx));
                             group_parameters.push_back(Parameter(parameters_data, idx));
@@ -552,6 +597,18 @@ namespace eos
         return _imp->parameters[id];
     }
 
+    Parameters::Generation
+    Parameters::generation() const
+    {
+        return _imp->parameters_data->generation;
+    }
+
+    Parameters::Generation
+    Parameters::generation(const Parameter::Id & id) const
+    {
+        return _imp->parameters_data->data[id].generation;
+    }
+
     Parameter
     Parameters::declare(const std::string & name, double value)
     {
@@ -562,7 +619,7 @@ namespace eos
 
         // create new parameter
         unsigned idx = _imp->parameters.size();
-        _imp->parameters_data->data.push_back(Parameter::Data(Parameter::Template { name, value, value, value, "LaTeX display not supported for run-time declared parameters" }, idx));
+        _imp->parameters_data->push_back(Parameter::Data(Parameter::Template { name, value, value, value, "LaTeX display not supported for run-time declared parameters" }, idx));
         _imp->parameters_map[name] = idx;
         _imp->parameters.push_back(Parameter(_imp->parameters_data, idx));
 
@@ -577,7 +634,32 @@ namespace eos
         if (_imp->parameters_map.end() == i)
             throw UnknownParameterError(name);
 
-        _imp->parameters_data->data[i->second].value = value;
+        _imp->parameters_data->set(i->second, value);
+    }
+
+    void
+    Parameters::set_many(const std::vector<Parameter::Id> & ids, const std::vector<double> & values)
+    {
+        if (ids.size() != values.size())
+            throw InternalError("Parameters::set_many: number of ids '" + stringify(ids.size()) + "' does not match number of values '"
+                    + stringify(values.size()) + "'");
+
+        set_many(ids.data(), values.data(), ids.size());
+    }
+
+    void
+    Parameters::set_many(const Parameter::Id * ids, const double * values, const std::size_t & n)
+    {
+        const auto size = _imp->parameters_data->values.size();
+
+        // validate all ids before changing any value
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            if (ids[i] >= size)
+                throw InternalError("Parameters::set_many: invalid id '" + stringify(ids[i]) + "'");
+        }
+
+        _imp->parameters_data->set_many(ids, values, n);
     }
 
     Parameters::Iterator
@@ -649,25 +731,25 @@ namespace eos
 
     Parameter::operator double () const
     {
-        return _parameters_data->data[_index].value;
+        return _parameters_data->values[_index];
     }
 
     double
     Parameter::operator() () const
     {
-        return _parameters_data->data[_index].value;
+        return _parameters_data->values[_index];
     }
 
     double
     Parameter::evaluate() const
     {
-        return _parameters_data->data[_index].value;
+        return _parameters_data->values[_index];
     }
 
     const Parameter &
     Parameter::operator= (const double & value)
     {
-        _parameters_data->data[_index].value = value;
+        _parameters_data->set(_index, value);
 
         return *this;
     }
@@ -675,7 +757,7 @@ namespace eos
     void
     Parameter::set(const double & value)
     {
-        _parameters_data->data[_index].value = value;
+        _parameters_data->set(_index, value);
     }
 
     const double &
@@ -765,8 +847,15 @@ namespace eos
         _ids.insert(other._ids.cbegin(), other._ids.cend());
     }
 
+    ParameterHandle
+    Parameter::handle() const
+    {
+        return ParameterHandle(&_parameters_data->values, _index);
+    }
+
     UsedParameter::UsedParameter(const Parameter & parameter, ParameterUser & user) :
-        Parameter(parameter)
+        Parameter(parameter),
+        _handle(parameter.handle())
     {
         user.uses(parameter.id());
     }
@@ -28,6 +28,7 @@
 #include <eos/utils/wrapped_forward_iterator.hh>
 
 #include <set>
+#include <vector>
 
 namespace eos
 {
@@ -105,6 +106,12 @@ namespace eos
             friend struct Implementation<Parameter>;
             friend struct Implementation<Parameters>;
 
+            /*!
+             * A monotonically increasing counter that is advanced whenever
+             * the numeric value of any parameter changes.
+             */
+            using Generation = unsigned long;
+
             ///@name Basic Functions
             ///@{
             /*!
@@ -157,6 +164,26 @@ namespace eos
              */
             void set(const std::string & name, const double & value);
 
+            /*!
+             * Set the numeric values of several parameters at once.
+             *
+             * All changes share a single new generation, i.e., the generation
+             * advances at most once per call.
+             *
+             * @param ids    The ids of the parameters whose numeric values shall be changed.
+             * @param values The parameters' new numeric values, in the same order as ids.
+             */
+            void set_many(const std::vector<unsigned> & ids, const std::vector<double> & values);
+
+            /*!
+             * Set the numeric values of several parameters at once.
+             *
+             * @param ids    Pointer to n ids of the parameters whose numeric values shall be changed.
+             * @param values Pointer to n new numeric values, in the same order as ids.
+             * @param n      The number of parameters to be changed.
+             */
+            void set_many(const unsigned * ids, const double * values, const std::size_t & n);
+
             /*!
              * Retrieve a parameter's Parameter object by name.
              *
@@ -171,6 +198,16 @@ namespace eos
              */
             Parameter operator[] (const unsigned & id) const;
 
+            /// Retrieve the current generation of the parameter values.
+            Generation generation() const;
+
+            /*!
+             * Retrieve the generation at which a parameter's numeric value has last been changed.
+             *
+             * @param id    The id of the Parameter whose generation shall be retrieved.
+             */
+            Generation generation(const unsigned & id) const;
+
             /*!
              * Override the parameter values from an external YAML file.
              *
@@ -190,6 +227,40 @@ namespace eos
 
     extern template class WrappedForwardIterator<Parameters::IteratorTag, Parameter>;
 
+    /*!
+     * ParameterHandle provides fast, read-only access to the numeric value of a Parameter.
+     *
+     * Reading the value is neither virtual nor out-of-line: it amounts to an indexed
+     * load from the contiguous array of numeric values of the parent Parameters object.
+     * A handle does not keep its parent Parameters object alive.
+     */
+    class ParameterHandle
+    {
+        private:
+            const std::vector<double> * _values;
+
+            unsigned _index;
+
+        public:
+            ParameterHandle(const std::vector<double> * values, const unsigned & index) :
+                _values(values),
+                _index(index)
+            {
+            }
+
+            /// Cast the Parameter's numeric value to a double.
+            operator double () const
+            {
+                return (*_values)[_index];
+            }
+
+            /// Retrieve the Parameter's numeric value.
+            double operator() () const
+            {
+                return (*_values)[_index];
+            }
+    };
+
     /*!
      * Parameter is the class that holds all information of one of Parameters' parameters.
      */
@@ -274,6 +345,9 @@ namespace eos
             /// Retrieve the Parameter's id.
             Id id() const;
 
+            /// Retrieve a handle for fast access to the Parameter's numeric value.
+            ParameterHandle handle() const;
+
             /// Retrieve the Parameter's name as a LaTeX representation
             const std::string & latex() const;
             ///@}
@@ -384,10 +458,16 @@ namespace eos
 
     /*!
      * Wrapper class to automate usage tracking of Parameter objects.
+     *
+     * Reads of the numeric value use a ParameterHandle and can be inlined
+     * into the calling code.
      */
     class UsedParameter :
         public Parameter
     {
+        private:
+            ParameterHandle _handle;
+
         public:
             /*!
              * Constructor.
@@ -398,6 +478,27 @@ namespace eos
              * @param user      The user of above parameter.
              */
             UsedParameter(const Parameter & parameter, ParameterUser & user);
+
+            ///@name Access to the Numeric Value
+            ///@{
+            /// Cast a Parameter's numeric value to a double.
+            virtual operator double () const final
+            {
+                return _handle();
+            }
+
+            /// Retrieve a Parameter's numeric value.
+            virtual double operator() () const final
+            {
+                return _handle();
+            }
+
+            /// Retrieve a Parameter's numeric value.
+            virtual double evaluate() const final
+            {
+                return _handle();
+            }
+            ///@}
     };
 
     struct ParameterDescription
@@ -20,6 +20,8 @@
 #include <test/test.hh>
 #include <eos/utils/parameters.hh>
 
+#include <string>
+
 using namespace test;
 using namespace eos;
 
@@ -71,5 +73,99 @@ class ParametersTest :
                 TEST_CHECK_EQUAL(m_c_original(), 0.0);
                 TEST_CHECK_EQUAL(m_c_clone(), m_c_clone.central());
             }
+
+            // Generations
+            {
+                Parameters parameters = Parameters::Defaults();
+                Parameter m_b = parameters["mass::b(MSbar)"];
+                Parameter m_c = parameters["mass::c"];
+
+                const Parameters::Generation initial = parameters.generation();
+                TEST_CHECK_EQUAL(parameters.generation(m_b.id()), 0);
+                TEST_CHECK_EQUAL(parameters.generation(m_c.id()), 0);
+
+                // setting the current value does not advance the generation
+                m_c = m_c();
+                TEST_CHECK_EQUAL(parameters.generation(), initial);
+                TEST_CHECK_EQUAL(parameters.generation(m_c.id()), 0);
+
+                m_c = 1.0;
+                TEST_CHECK_EQUAL(parameters.generation(), initial + 1);
+                TEST_CHECK_EQUAL(parameters.generation(m_c.id()), initial + 1);
+                TEST_CHECK_EQUAL(parameters.generation(m_b.id()), 0);
+
+                parameters.set("mass::b(MSbar)", 4.0);
+                TEST_CHECK_EQUAL(parameters.generation(), initial + 2);
+                TEST_CHECK_EQUAL(parameters.generation(m_c.id()), initial + 1);
+                TEST_CHECK_EQUAL(parameters.generation(m_b.id()), initial + 2);
+
+                // clones keep track of their generations independently
+                Parameters clone = parameters.clone();
+                clone.set("mass::c", 2.0);
+                TEST_CHECK_EQUAL(clone.generation(), initial + 3);
+                TEST_CHECK_EQUAL(parameters.generation(), initial + 2);
+            }
+
+            // Setting many parameters at once
+            {
+                Parameters parameters = Parameters::Defaults();
+                Parameter m_b = parameters["mass::b(MSbar)"];
+                Parameter m_c = parameters["mass::c"];
+                Parameter m_s = parameters["mass::s(2GeV)"];
+
+                const Parameters::Generation initial = parameters.generation();
+
+                parameters.set_many({ m_b.id(), m_c.id(), m_s.id() }, { 4.0, 1.0, m_s() });
+                TEST_CHECK_EQUAL(m_b(), 4.0);
+                TEST_CHECK_EQUAL(m_c(), 1.0);
+                TEST_CHECK_EQUAL(parameters.generation(), initial + 1);
+                TEST_CHECK_EQUAL(parameters.generation(m_b.id()), initial + 1);
+                TEST_CHECK_EQUAL(parameters.generation(m_c.id()), initial + 1);
+                TEST_CHECK_EQUAL(parameters.generation(m_s.id()), 0);
+
+                // setting the current values does not advance the generation
+                parameters.set_many({ m_b.id(), m_c.id() }, { 4.0, 1.0 });
+                TEST_CHECK_EQUAL(parameters.generation(), initial + 1);
+
+                // invalid input leaves all parameters untouched
+                TEST_CHECK_THROWS(InternalError, parameters.set_many({ m_b.id(), m_c.id() }, { 5.0 }));
+                TEST_CHECK_THROWS(InternalError, parameters.set_many({ m_b.id(), 1000000u }, { 5.0, 2.0 }));
+                TEST_CHECK_EQUAL(m_b(), 4.0);
+                TEST_CHECK_EQUAL(parameters.generation(), initial + 1);
+            }
+
+            // Handles and used parameters
+            {
+                Parameters original = Parameters::Defaults();
+                Parameters clone = original.clone();
+                ParameterUser user;
+
+                UsedParameter m_c_original(original["mass::c"], user);
+                UsedParameter m_c_clone(clone["mass::c"], user);
+                ParameterHandle h = original["mass::c"].handle();
+
+                TEST_CHECK_EQUAL(h(), m_c_original.central());
+                TEST_CHECK_EQUAL(m_c_original(), m_c_original.central());
+
+                original["mass::c"] = 1.0;
+                TEST_CHECK_EQUAL(h(), 1.0);
+                TEST_CHECK_EQUAL(double(h), 1.0);
+                TEST_CHECK_EQUAL(m_c_original(), 1.0);
+                TEST_CHECK_EQUAL(m_c_original.evaluate(), 1.0);
+                TEST_CHECK_EQUAL(m_c_clone(), m_c_clone.central());
+
+                // handles remain valid when new parameters are declared
+                for (unsigned i = 0 ; i < 1000 ; ++i)
+                {
+                    original.declare("test::p" + std::to_string(i), i);
+                }
+                original.set("mass::c", 2.0);
+                TEST_CHECK_EQUAL(h(), 2.0);
+                TEST_CHECK_EQUAL(m_c_original(), 2.0);
+                TEST_CHECK_EQUAL(original["test::p999"](), 999.0);
+
+                // access by id works for clones
+                TEST_CHECK_EQUAL(clone[m_c_clone.id()](), m_c_clone.central());
+            }
         }
 } parameters_test;
@@ -22,6 +22,8 @@
 
 #include <eos/utils/private_implementation_pattern.hh>
 
+#include <utility>
+
 namespace eos
 {
     template <typename T_>
@@ -30,6 +32,12 @@ namespace eos
     {
     }
 
+    template <typename T_>
+    PrivateImplementationPattern<T_>::PrivateImplementationPattern(std::shared_ptr<Implementation<T_> > && imp) :
+        _imp(std::move(imp))
+    {
+    }
+
     template <typename T_>
     PrivateImplementationPattern<T_>::~PrivateImplementationPattern()
     {
@@ -34,6 +34,8 @@ namespace eos
         public:
             explicit PrivateImplementationPattern(Implementation<T_> * imp);
 
+            explicit PrivateImplementationPattern(std::shared_ptr<Implementation<T_> > && imp);
+
             ~PrivateImplementationPattern();
     };
 }
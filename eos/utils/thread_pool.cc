@@ -18,19 +18,337 @@
  */
 
 #include <eos/utils/condition_variable.hh>
+#include <eos/utils/destringify.hh>
+#include <eos/utils/exception.hh>
 #include <eos/utils/instantiation_policy-impl.hh>
 #include <eos/utils/lock.hh>
+#include <eos/utils/log.hh>
 #include <eos/utils/mutex.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/thread.hh>
 #include <eos/utils/thread_pool.hh>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstddef>
+#include <limits>
 #include <list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
 
+#include <pthread.h>
+#include <sched.h>
 #include <unistd.h>
 
 namespace eos
 {
+    namespace thread_pool
+    {
+        static const unsigned no_worker = std::numeric_limits<unsigned>::max();
+
+        /// Index of the pool's worker that runs on the current thread, or no_worker for any other thread.
+        static thread_local unsigned current_worker = no_worker;
+
+        /// A job together with the ticket that reports its completion.
+        struct QueuedJob
+        {
+            Ticket ticket;
+
+            ThreadPoolJob job;
+        };
+
+        /// Uninitialised storage for one QueuedJob.
+        class JobSlot
+        {
+            private:
+                typename std::aligned_storage<sizeof(QueuedJob), alignof(QueuedJob)>::type _storage;
+
+            public:
+                QueuedJob & operator* ()
+                {
+                    return *reinterpret_cast<QueuedJob *>(&_storage);
+                }
+
+                void emplace(QueuedJob && job)
+                {
+                    new (&_storage) QueuedJob(std::move(job));
+                }
+
+                void destroy()
+                {
+                    (**this).~QueuedJob();
+                }
+
+                // Move our job into the empty slot other, leaving this slot empty.
+                void move_to(JobSlot & other)
+                {
+                    other.emplace(std::move(**this));
+                    destroy();
+                }
+        };
+
+        /*!
+         * Double-ended queue of jobs, implemented as a growing ring buffer.
+         *
+         * Its owner pushes and pops at the back, thieves steal from the front.
+         * The buffer is never shrunk, so that the queue does not allocate once
+         * it has reached its working size.
+         */
+        struct JobQueue
+        {
+            Mutex mutex;
+
+            std::vector<JobSlot> slots;
+
+            std::size_t head;
+
+            std::size_t size;
+
+            JobQueue() :
+                slots(64),
+                head(0),
+                size(0)
+            {
+            }
+
+            ~JobQueue()
+            {
+                for ( ; size > 0 ; --size, head = (head + 1) & mask())
+                {
+                    slots[head].destroy();
+                }
+            }
+
+            std::size_t mask() const
+            {
+                return slots.size() - 1;
+            }
+
+            void push_back(QueuedJob && job)
+            {
+                if (size == slots.size())
+                {
+                    std::vector<JobSlot> larger(2 * slots.size());
+                    for (std::size_t i = 0 ; i < size ; ++i)
+                    {
+                        slots[(head + i) & mask()].move_to(larger[i]);
+                    }
+
+                    std::swap(slots, larger);
+                    head = 0;
+                }
+
+                slots[(head + size) & mask()].emplace(std::move(job));
+                ++size;
+            }
+
+            bool pop_back(JobSlot & job)
+            {
+                if (0 == size)
+                    return false;
+
+                --size;
+                slots[(head + size) & mask()].move_to(job);
+
+                return true;
+            }
+
+            bool pop_front(JobSlot & job)
+            {
+                if (0 == size)
+                    return false;
+
+                slots[head].move_to(job);
+                head = (head + 1) & mask();
+                --size;
+
+                return true;
+            }
+        };
+
+        /*!
+         * Bounded multi-producer/multi-consumer queue of jobs, following
+         * D. Vyukov's lock-free ring buffer design. Each cell carries a sequence
+         * number that tells producers and consumers whether it is free or occupied.
+         */
+        class SharedJobQueue
+        {
+            private:
+                struct Cell
+                {
+                    std::atomic<std::size_t> sequence;
+
+                    JobSlot slot;
+                };
+
+                std::unique_ptr<Cell[]> _cells;
+
+                const std::size_t _mask;
+
+                // keep producers and consumers on separate cache lines
+                char _padding1[64];
+
+                std::atomic<std::size_t> _enqueue_position;
+
+                char _padding2[64];
+
+                std::atomic<std::size_t> _dequeue_position;
+
+            public:
+                SharedJobQueue(const std::size_t & capacity) :
+                    _cells(new Cell[capacity]),
+                    _mask(capacity - 1),
+                    _enqueue_position(0),
+                    _dequeue_position(0)
+                {
+                    for (std::size_t i = 0 ; i < capacity ; ++i)
+                    {
+                        _cells[i].sequence.store(i, std::memory_order_relaxed);
+                    }
+                }
+
+                ~SharedJobQueue()
+                {
+                    JobSlot job;
+                    while (pop(job))
+                    {
+                        job.destroy();
+                    }
+                }
+
+                // Returns false if the queue is full.
+                bool push(QueuedJob && job)
+                {
+                    Cell * cell;
+                    std::size_t position = _enqueue_position.load(std::memory_order_relaxed);
+
+                    while (true)
+                    {
+                        cell = &_cells[position & _mask];
+                        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                        std::ptrdiff_t difference = std::ptrdiff_t(sequence) - std::ptrdiff_t(position);
+
+                        if (0 == difference)
+                        {
+                            if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                                break;
+                        }
+                        else if (difference < 0)
+                        {
+                            return false;
+                        }
+                        else
+                        {
+                            position = _enqueue_position.load(std::memory_order_relaxed);
+                        }
+                    }
+
+                    cell->slot.emplace(std::move(job));
+                    cell->sequence.store(position + 1, std::memory_order_release);
+
+                    return true;
+                }
+
+                // Returns false if the queue is empty.
+                bool pop(JobSlot & job)
+                {
+                    Cell * cell;
+                    std::size_t position = _dequeue_position.load(std::memory_order_relaxed);
+
+                    while (true)
+                    {
+                        cell = &_cells[position & _mask];
+                        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                        std::ptrdiff_t difference = std::ptrdiff_t(sequence) - std::ptrdiff_t(position + 1);
+
+                        if (0 == difference)
+                        {
+                            if (_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                                break;
+                        }
+                        else if (difference < 0)
+                        {
+                            return false;
+                        }
+                        else
+                        {
+                            position = _dequeue_position.load(std::memory_order_relaxed);
+                        }
+                    }
+
+                    cell->slot.move_to(job);
+                    cell->sequence.store(position + _mask + 1, std::memory_order_release);
+
+                    return true;
+                }
+        };
+
+        /// The CPUs that we are allowed to run on.
+        static std::vector<int> available_cpus()
+        {
+            std::vector<int> result;
+
+#ifdef __linux__
+            cpu_set_t set;
+            CPU_ZERO(&set);
+
+            if (0 == sched_getaffinity(0, sizeof(cpu_set_t), &set))
+            {
+                for (int cpu = 0 ; cpu < CPU_SETSIZE ; ++cpu)
+                {
+                    if (CPU_ISSET(cpu, &set))
+                        result.push_back(cpu);
+                }
+            }
+#endif
+
+            if (result.empty())
+            {
+                for (long cpu = 0, cpu_end = sysconf(_SC_NPROCESSORS_ONLN) ; cpu < cpu_end ; ++cpu)
+                {
+                    result.push_back(cpu);
+                }
+            }
+
+            return result;
+        }
+
+        /// Default number of threads, as set by EOS_NUM_THREADS or otherwise the number of available CPUs.
+        static unsigned default_number_of_threads()
+        {
+            if (const char * envvar = std::getenv("EOS_NUM_THREADS"))
+            {
+                try
+                {
+                    unsigned result = destringify<unsigned>(envvar);
+
+                    if (result > 0)
+                        return result;
+                }
+                catch (DestringifyError &)
+                {
+                }
+
+                Log::instance()->message("ThreadPool", ll_warning)
+                    << "Ignoring invalid value '" << envvar << "' of EOS_NUM_THREADS";
+            }
+
+            return std::max<std::size_t>(1u, available_cpus().size());
+        }
+
+        /// Default pinning, as set by EOS_PIN_THREADS.
+        static bool default_pinning()
+        {
+            const char * envvar = std::getenv("EOS_PIN_THREADS");
+
+            return envvar && ((std::string("1") == envvar) || (std::string("true") == envvar));
+        }
+    }
+
     template <>
     struct Implementation<ThreadPool>
     {
@@ -38,104 +356,243 @@ namespace eos
         unsigned long nominal_capacity;
         unsigned long stop_capacity;
 
-        // Thread termination
-        Mutex * const terminate_mutex;
+        // Thread affinity
+        bool pin_threads;
+        std::vector<int> cpus;
 
+        // Thread termination
         bool terminate;
 
-        // Job handling
-        Mutex * const job_mutex;
+        // Job handling; one queue per worker, plus a shared queue for jobs submitted by
+        // other threads, which overflows into a growing queue once it is full
+        std::vector<std::unique_ptr<thread_pool::JobQueue>> queues;
+
+        thread_pool::SharedJobQueue shared_queue;
+
+        thread_pool::JobQueue overflow_queue;
+
+        std::atomic<unsigned long> overflow_jobs;
+
+        std::atomic<unsigned long> queued_jobs;
+
+        // Idle workers and capacity control
+        Mutex * const idle_mutex;
 
         ConditionVariable * const job_arrival;
         ConditionVariable * const job_capacity;
 
-        unsigned long waiting_for_jobs;
-        unsigned long pending_jobs;
+        std::atomic<unsigned long> waiting_for_jobs;
+        std::atomic<unsigned long> pending_jobs;
 
-        std::list<std::pair<Ticket, std::function<void (void)> *>> queue;
+        // Statistics
+        std::atomic<unsigned long> max_queued_jobs;
+        std::atomic<unsigned long> completed_jobs;
+        std::atomic<unsigned long> stolen_jobs;
+        double idle_time;
 
         std::list<Thread *> threads;
 
-        void thread_function()
+        bool pop(thread_pool::JobQueue & queue, thread_pool::JobSlot & job, bool from_back)
         {
-            std::function<void (void)> * job;
-            Ticket ticket;
+            Lock l(queue.mutex);
 
-            do
+            return from_back ? queue.pop_back(job) : queue.pop_front(job);
+        }
+
+        bool pop_shared(thread_pool::JobSlot & job)
+        {
+            if (shared_queue.pop(job))
+                return true;
+
+            if ((overflow_jobs.load() > 0) && pop(overflow_queue, job, false))
+            {
+                overflow_jobs -= 1;
+
+                return true;
+            }
+
+            return false;
+        }
+
+        // Find a job, preferring the most recent one of our own queue, then older jobs of other threads.
+        bool find_job(thread_pool::JobSlot & job)
+        {
+            const unsigned worker = thread_pool::current_worker;
+
+            if ((worker != thread_pool::no_worker) && pop(*queues[worker], job, true))
+                return true;
+
+            if (pop_shared(job))
+                return true;
+
+            const unsigned start = (worker != thread_pool::no_worker) ? worker + 1 : 0;
+            for (unsigned i = 0 ; i < number_of_threads ; ++i)
             {
+                unsigned victim = (start + i) % number_of_threads;
+                if (victim == worker)
+                    continue;
+
+                if (pop(*queues[victim], job, false))
                 {
-                    Lock l(*terminate_mutex);
-                    if (terminate)
-                        break;
+                    stolen_jobs += 1;
+
+                    return true;
                 }
+            }
 
-                job = 0;
+            return false;
+        }
 
-                {
-                    Lock l(*job_mutex);
+        bool run_pending_job()
+        {
+            if (0 == queued_jobs.load())
+                return false;
 
-                    if (queue.empty())
-                    {
-                        waiting_for_jobs += 1;
-                        job_arrival->wait(*job_mutex);
-                        waiting_for_jobs -= 1;
-                    }
+            thread_pool::JobSlot slot;
+            if (! find_job(slot))
+                return false;
 
-                    if (queue.empty())
-                    {
-                        Lock l(*terminate_mutex);
-                        if (terminate)
-                            break;
-                        else
-                            continue;
-                    }
+            queued_jobs -= 1;
 
-                    ticket = queue.front().first;
-                    job = queue.front().second;
-                    queue.pop_front();
-                }
+            thread_pool::QueuedJob & job = *slot;
 
-                (*job)();
-                {
-                    Lock l(*job_mutex);
-                    pending_jobs -= 1;
+            try
+            {
+                job.job();
+            }
+            catch (...)
+            {
+                complete(job.ticket);
+                slot.destroy();
+                throw;
+            }
+
+            complete(job.ticket);
+            slot.destroy();
+
+            return true;
+        }
+
+        void complete(Ticket & ticket)
+        {
+            completed_jobs += 1;
+
+            if (pending_jobs.fetch_sub(1) - 1 == nominal_capacity)
+            {
+                Lock l(*idle_mutex);
+                job_capacity->signal();
+            }
+
+            ticket.mark();
+        }
+
+        void thread_function(unsigned index)
+        {
+            thread_pool::current_worker = index;
+
+#ifdef __linux__
+            if (pin_threads)
+            {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(cpus[index % cpus.size()], &set);
+
+                pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+            }
+#endif
+
+            do
+            {
+                if (run_pending_job())
+                    continue;
 
-                    if (pending_jobs == nominal_capacity)
-                        job_capacity->signal();
+                Lock l(*idle_mutex);
 
+                if (terminate)
+                    break;
+
+                // announce that we are waiting before checking for jobs one last time,
+                // so that enqueue() either sees us waiting or we see its job
+                waiting_for_jobs += 1;
+
+                if (queued_jobs.load() > 0)
+                {
+                    waiting_for_jobs -= 1;
+                    continue;
                 }
-                ticket.mark();
+
+                auto start = std::chrono::steady_clock::now();
+                job_arrival->wait(*idle_mutex);
+                waiting_for_jobs -= 1;
+                idle_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
             }
             while (true);
         }
 
-        Implementation() :
-            number_of_threads(sysconf(_SC_NPROCESSORS_CONF)),
-            nominal_capacity(number_of_threads * 10),
-            stop_capacity(nominal_capacity * 2),
-            terminate_mutex(new Mutex),
-            terminate(false),
-            job_mutex(new Mutex),
-            job_arrival(new ConditionVariable),
-            job_capacity(new ConditionVariable),
-            waiting_for_jobs(0),
-            pending_jobs(0)
+        Ticket enqueue(ThreadPoolJob && work)
         {
-            for (unsigned i(0) ; i < number_of_threads ; ++i)
+            thread_pool::QueuedJob job{ Ticket(), std::move(work) };
+            Ticket result = job.ticket;
+
+            pending_jobs += 1;
+
+            // count the job before it becomes visible, so that the count never drops below zero
+            unsigned long depth = (queued_jobs += 1);
+            unsigned long max_depth = max_queued_jobs.load();
+            while ((depth > max_depth) && ! max_queued_jobs.compare_exchange_weak(max_depth, depth))
+            {
+            }
+
+            const unsigned worker = thread_pool::current_worker;
+            if (worker != thread_pool::no_worker)
+            {
+                thread_pool::JobQueue & queue = *queues[worker];
+                Lock l(queue.mutex);
+                queue.push_back(std::move(job));
+            }
+            else if (! shared_queue.push(std::move(job)))
+            {
+                Lock l(overflow_queue.mutex);
+                overflow_queue.push_back(std::move(job));
+                overflow_jobs += 1;
+            }
+
+            if (waiting_for_jobs.load() > 0)
             {
-                threads.push_back(new Thread(std::bind(&Implementation<ThreadPool>::thread_function, this)));
+                Lock l(*idle_mutex);
+                job_arrival->signal();
             }
+
+            return result;
         }
 
-        ~Implementation()
+        // Start the worker threads. Requires all previous workers to be stopped.
+        void start(const unsigned & size, const bool & pin)
         {
+            number_of_threads = size;
+            nominal_capacity = number_of_threads * 10;
+            stop_capacity = nominal_capacity * 2;
+            pin_threads = pin;
+            terminate = false;
+
+            queues.clear();
+            for (unsigned i(0) ; i < number_of_threads ; ++i)
             {
-                Lock l(*terminate_mutex);
-                terminate = true;
+                queues.push_back(std::unique_ptr<thread_pool::JobQueue>(new thread_pool::JobQueue));
+            }
+
+            for (unsigned i(0) ; i < number_of_threads ; ++i)
+            {
+                threads.push_back(new Thread(std::bind(&Implementation<ThreadPool>::thread_function, this, i)));
             }
+        }
 
+        // Stop all threads. The workers only terminate once no pending jobs remain.
+        void stop()
+        {
             {
-                Lock l(*job_mutex);
+                Lock l(*idle_mutex);
+                terminate = true;
                 job_arrival->broadcast();
             }
 
@@ -143,6 +600,40 @@ namespace eos
             {
                 delete *t;
             }
+
+            threads.clear();
+        }
+
+        Implementation() :
+            number_of_threads(0),
+            nominal_capacity(0),
+            stop_capacity(0),
+            pin_threads(false),
+            cpus(thread_pool::available_cpus()),
+            terminate(false),
+            shared_queue(4096),
+            overflow_jobs(0),
+            queued_jobs(0),
+            idle_mutex(new Mutex),
+            job_arrival(new ConditionVariable),
+            job_capacity(new ConditionVariable),
+            waiting_for_jobs(0),
+            pending_jobs(0),
+            max_queued_jobs(0),
+            completed_jobs(0),
+            stolen_jobs(0),
+            idle_time(0.0)
+        {
+            start(thread_pool::default_number_of_threads(), thread_pool::default_pinning());
+        }
+
+        ~Implementation()
+        {
+            stop();
+
+            delete job_capacity;
+            delete job_arrival;
+            delete idle_mutex;
         }
     };
 
@@ -157,20 +648,9 @@ namespace eos
     }
 
     Ticket
-    ThreadPool::enqueue(const std::function<void (void)> & job)
+    ThreadPool::enqueue(ThreadPoolJob && job)
     {
-        std::pair<Ticket, std::function<void (void)> *> item(Ticket(), new std::function<void (void)>(job));
-
-        {
-            Lock l(*_imp->job_mutex);
-            _imp->queue.push_back(item);
-            _imp->pending_jobs += 1;
-
-            if (_imp->waiting_for_jobs > 0)
-                _imp->job_arrival->signal();
-        }
-
-        return item.first;
+        return _imp->enqueue(std::move(job));
     }
 
     ThreadPool *
@@ -179,15 +659,27 @@ namespace eos
         return InstantiationPolicy<ThreadPool, Singleton>::instance();
     }
 
+    bool
+    ThreadPool::run_pending_job()
+    {
+        return _imp->run_pending_job();
+    }
+
+    bool
+    ThreadPool::is_worker_thread()
+    {
+        return thread_pool::no_worker != thread_pool::current_worker;
+    }
+
     void
     ThreadPool::wait_for_free_capacity()
     {
-        Lock l(*_imp->job_mutex);
+        Lock l(*_imp->idle_mutex);
 
-        if (_imp->pending_jobs < _imp->stop_capacity)
+        if (_imp->pending_jobs.load() < _imp->stop_capacity)
             return;
 
-        _imp->job_capacity->wait(*_imp->job_mutex);
+        _imp->job_capacity->wait(*_imp->idle_mutex);
     }
 
     unsigned
@@ -195,5 +687,37 @@ namespace eos
     {
         return _imp->number_of_threads;
     }
-}
 
+    void
+    ThreadPool::resize(const unsigned & number_of_threads, const bool & pin_threads)
+    {
+        if (0 == number_of_threads)
+            throw InternalError("ThreadPool::resize: number of threads must be positive");
+
+        if (is_worker_thread())
+            throw InternalError("ThreadPool::resize: cannot resize from within a job");
+
+        _imp->stop();
+        _imp->start(number_of_threads, pin_threads);
+    }
+
+    ThreadPool::Statistics
+    ThreadPool::statistics() const
+    {
+        Statistics result;
+        result.number_of_threads = _imp->number_of_threads;
+        result.queued_jobs       = _imp->queued_jobs.load();
+        result.max_queued_jobs   = _imp->max_queued_jobs.load();
+        result.completed_jobs    = _imp->completed_jobs.load();
+        result.stolen_jobs       = _imp->stolen_jobs.load();
+
+        {
+            Lock l(*_imp->idle_mutex);
+            result.pending_jobs  = _imp->pending_jobs.load();
+            result.idle_threads  = _imp->waiting_for_jobs.load();
+            result.idle_time     = _imp->idle_time;
+        }
+
+        return result;
+    }
+}
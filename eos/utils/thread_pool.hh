@@ -24,26 +24,238 @@
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/ticket.hh>
 
+#include <cstddef>
 #include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace eos
 {
+    /*!
+     * Type-erased, move-only job of the ThreadPool.
+     *
+     * Callables of up to inline_size bytes, e.g. lambdas with a few captures,
+     * a std::function, or the result of std::bind, are stored inline without
+     * any heap allocation. Larger callables are stored on the heap.
+     */
+    class ThreadPoolJob
+    {
+        public:
+            static constexpr std::size_t inline_size = 64;
+
+        private:
+            enum class Operation { move, destroy };
+
+            using Storage = typename std::aligned_storage<inline_size, alignof(std::max_align_t)>::type;
+
+            Storage _storage;
+
+            void (* _invoke)(Storage &);
+
+            void (* _manage)(Operation, Storage &, Storage &);
+
+            template <typename F_, bool inline_ = (sizeof(F_) <= inline_size) && (alignof(F_) <= alignof(std::max_align_t))
+                && std::is_nothrow_move_constructible<F_>::value>
+            struct Handler
+            {
+                static F_ * get(Storage & s) { return reinterpret_cast<F_ *>(&s); }
+
+                static void create(Storage & s, F_ && f) { new (&s) F_(std::move(f)); }
+
+                static void invoke(Storage & s) { (*get(s))(); }
+
+                static void manage(Operation op, Storage & from, Storage & to)
+                {
+                    if (Operation::move == op)
+                        new (&to) F_(std::move(*get(from)));
+
+                    get(from)->~F_();
+                }
+            };
+
+            template <typename F_>
+            struct Handler<F_, false>
+            {
+                static F_ * & get(Storage & s) { return *reinterpret_cast<F_ **>(&s); }
+
+                static void create(Storage & s, F_ && f) { new (&s) F_ *(new F_(std::move(f))); }
+
+                static void invoke(Storage & s) { (*get(s))(); }
+
+                static void manage(Operation op, Storage & from, Storage & to)
+                {
+                    if (Operation::move == op)
+                        new (&to) F_ *(get(from));
+                    else
+                        delete get(from);
+                }
+            };
+
+            void reset()
+            {
+                if (_manage)
+                    _manage(Operation::destroy, _storage, _storage);
+
+                _invoke = nullptr;
+                _manage = nullptr;
+            }
+
+        public:
+            ThreadPoolJob() :
+                _invoke(nullptr),
+                _manage(nullptr)
+            {
+            }
+
+            template <typename F_, typename = typename std::enable_if<! std::is_same<typename std::decay<F_>::type, ThreadPoolJob>::value>::type>
+            ThreadPoolJob(F_ && f)
+            {
+                using Function = typename std::decay<F_>::type;
+
+                Handler<Function>::create(_storage, Function(std::forward<F_>(f)));
+                _invoke = &Handler<Function>::invoke;
+                _manage = &Handler<Function>::manage;
+            }
+
+            ThreadPoolJob(ThreadPoolJob && other) :
+                _invoke(other._invoke),
+                _manage(other._manage)
+            {
+                if (_manage)
+                    _manage(Operation::move, other._storage, _storage);
+
+                other._invoke = nullptr;
+                other._manage = nullptr;
+            }
+
+            ThreadPoolJob & operator= (ThreadPoolJob && other)
+            {
+                if (this != &other)
+                {
+                    reset();
+
+                    _invoke = other._invoke;
+                    _manage = other._manage;
+
+                    if (_manage)
+                        _manage(Operation::move, other._storage, _storage);
+
+                    other._invoke = nullptr;
+                    other._manage = nullptr;
+                }
+
+                return *this;
+            }
+
+            ThreadPoolJob(const ThreadPoolJob &) = delete;
+
+            ThreadPoolJob & operator= (const ThreadPoolJob &) = delete;
+
+            ~ThreadPoolJob()
+            {
+                reset();
+            }
+
+            void operator() ()
+            {
+                _invoke(_storage);
+            }
+    };
+
+    /*!
+     * Pool of worker threads that execute jobs asynchronously.
+     *
+     * Each worker owns a queue of jobs. Jobs enqueued from within a worker are
+     * placed in its own queue, all other jobs in a shared queue. Idle workers
+     * steal jobs from the other queues. When a worker waits for a Ticket, it
+     * helps to execute pending jobs, so jobs can safely enqueue and wait for
+     * nested jobs. Since such a job then runs on the waiting job's stack, a job
+     * must not wait for a Ticket while it holds a lock that other jobs might
+     * acquire. Threads outside of the pool never execute jobs while waiting.
+     *
+     * By default, the pool uses as many threads as there are CPUs available to
+     * the process, which honours the process' CPU affinity mask. The environment
+     * variable EOS_NUM_THREADS overrides this number, and EOS_PIN_THREADS=1 pins
+     * each thread to one of the available CPUs.
+     */
     class ThreadPool :
         public InstantiationPolicy<ThreadPool, Singleton>,
         public PrivateImplementationPattern<ThreadPool>
     {
         public:
+            /// Usage statistics of the pool.
+            struct Statistics
+            {
+                /// Number of worker threads.
+                unsigned number_of_threads;
+
+                /// Number of jobs that are queued but not yet started.
+                unsigned long queued_jobs;
+
+                /// Largest number of queued jobs observed so far.
+                unsigned long max_queued_jobs;
+
+                /// Number of jobs that are queued or running.
+                unsigned long pending_jobs;
+
+                /// Number of completed jobs.
+                unsigned long completed_jobs;
+
+                /// Number of jobs that have been stolen from the queue of another worker.
+                unsigned long stolen_jobs;
+
+                /// Number of worker threads that are currently idle.
+                unsigned long idle_threads;
+
+                /// Total time in seconds that worker threads have spent waiting for jobs.
+                double idle_time;
+            };
+
             ThreadPool();
 
             ~ThreadPool();
 
-            Ticket enqueue(const std::function<void (void)> & work);
+            /// Enqueue a job for asynchronous execution.
+            Ticket enqueue(ThreadPoolJob && job);
+
+            /// Enqueue any callable without arguments for asynchronous execution.
+            template <typename F_>
+            Ticket enqueue(F_ && work)
+            {
+                return enqueue(ThreadPoolJob(std::forward<F_>(work)));
+            }
 
             static ThreadPool * instance();
 
+            /*!
+             * Execute one pending job on the calling thread, if there is any.
+             *
+             * Returns true if a job has been executed.
+             */
+            bool run_pending_job();
+
+            /// Return whether the calling thread is one of the pool's worker threads.
+            static bool is_worker_thread();
+
             void wait_for_free_capacity();
 
             unsigned number_of_threads() const;
+
+            /*!
+             * Change the number of worker threads.
+             *
+             * Waits for all pending jobs to complete before restarting the workers.
+             * Must neither be called from within a job, nor concurrently with any
+             * other use of the pool.
+             *
+             * \param number_of_threads  The new number of worker threads.
+             * \param pin_threads        If true, pin each thread to one of the available CPUs.
+             */
+            void resize(const unsigned & number_of_threads, const bool & pin_threads = false);
+
+            /// Retrieve the current usage statistics.
+            Statistics statistics() const;
     };
 }
 
@@ -0,0 +1,76 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/thread_pool.hh>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/*
+ * Measure the latency of enqueueing and completing many small jobs, as issued by the ObservableCache.
+ *
+ * Build with 'make thread_pool_BENCHMARK' and run without arguments.
+ */
+
+using namespace eos;
+
+int main(int, char **)
+{
+    static const unsigned rounds = 100;
+    static const unsigned jobs = 1000;
+
+    std::vector<double> results(jobs, 0.0);
+    std::vector<Ticket> tickets;
+    tickets.reserve(jobs);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned r = 0 ; r < rounds ; ++r)
+    {
+        tickets.clear();
+
+        for (unsigned i = 0 ; i < jobs ; ++i)
+        {
+            double * result = &results[i];
+            tickets.push_back(ThreadPool::instance()->enqueue([result, i]() { *result += i; }));
+        }
+
+        for (auto & t : tickets)
+        {
+            t.wait();
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    for (unsigned i = 0 ; i < jobs ; ++i)
+    {
+        if (double(rounds * i) != results[i])
+        {
+            std::cerr << "job " << i << " yielded " << results[i] << " instead of " << double(rounds * i) << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / (rounds * jobs);
+    std::cout << "# " << ThreadPool::instance()->number_of_threads() << " threads" << std::endl;
+    std::cout << "enqueue and completion of a small job: " << ns << " ns" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,192 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class ThreadPoolTest :
+    public TestCase
+{
+    public:
+        ThreadPoolTest() :
+            TestCase("thread_pool_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // Size from environment, which is read when the pool is first used
+            {
+                setenv("EOS_NUM_THREADS", "3", 1);
+
+                TEST_CHECK_EQUAL(3u, ThreadPool::instance()->number_of_threads());
+                TEST_CHECK_EQUAL(3u, ThreadPool::instance()->statistics().number_of_threads);
+            }
+
+            // Flat jobs
+            {
+                std::vector<double> results(1000, 0.0);
+                std::vector<Ticket> tickets;
+
+                for (unsigned i = 0 ; i < results.size() ; ++i)
+                {
+                    tickets.push_back(ThreadPool::instance()->enqueue([&results, i]() { results[i] = 2.0 * i; }));
+                }
+
+                for (auto & t : tickets)
+                {
+                    t.wait();
+                    TEST_CHECK(t.completed());
+                }
+
+                for (unsigned i = 0 ; i < results.size() ; ++i)
+                {
+                    TEST_CHECK_EQUAL(2.0 * i, results[i]);
+                }
+            }
+
+            // Nested jobs, with more outer jobs than threads that all wait for their inner jobs
+            {
+                const unsigned outer = 4 * ThreadPool::instance()->number_of_threads() + 1;
+                const unsigned inner = 50;
+
+                std::atomic<unsigned> counter(0);
+                std::vector<Ticket> tickets;
+
+                for (unsigned i = 0 ; i < outer ; ++i)
+                {
+                    tickets.push_back(ThreadPool::instance()->enqueue([&counter, inner]()
+                    {
+                        TicketList inner_tickets;
+                        for (unsigned j = 0 ; j < inner ; ++j)
+                        {
+                            inner_tickets.push_back(ThreadPool::instance()->enqueue([&counter]() { counter += 1; }));
+                        }
+
+                        inner_tickets.wait();
+                        counter += 1000;
+                    }));
+                }
+
+                for (auto & t : tickets)
+                {
+                    t.wait();
+                }
+
+                TEST_CHECK_EQUAL(outer * (inner + 1000), counter.load());
+            }
+
+            // Resizing and statistics
+            {
+                ThreadPool::instance()->resize(2);
+                TEST_CHECK_EQUAL(2u, ThreadPool::instance()->number_of_threads());
+
+                const ThreadPool::Statistics initial = ThreadPool::instance()->statistics();
+
+                TicketList tickets;
+                for (unsigned i = 0 ; i < 100 ; ++i)
+                {
+                    tickets.push_back(ThreadPool::instance()->enqueue([]() { }));
+                }
+                tickets.wait();
+
+                const ThreadPool::Statistics final = ThreadPool::instance()->statistics();
+                TEST_CHECK_EQUAL(2u,                           final.number_of_threads);
+                TEST_CHECK_EQUAL(initial.completed_jobs + 100, final.completed_jobs);
+                TEST_CHECK_EQUAL(0u,                           final.queued_jobs);
+                TEST_CHECK_EQUAL(0u,                           final.pending_jobs);
+                TEST_CHECK(final.max_queued_jobs >= 1);
+                TEST_CHECK(final.idle_time >= initial.idle_time);
+
+                ThreadPool::instance()->resize(1, true);
+                TEST_CHECK_EQUAL(1u, ThreadPool::instance()->number_of_threads());
+                double x = 0.0;
+                ThreadPool::instance()->enqueue([&x]() { x = 7.0; }).wait();
+                TEST_CHECK_EQUAL(7.0, x);
+
+                TEST_CHECK_THROWS(InternalError, ThreadPool::instance()->resize(0));
+            }
+
+            // Jobs of any size
+            {
+                std::array<double, 32> large;
+                large.fill(1.0);
+                double sum = 0.0;
+
+                ThreadPoolJob job([large, &sum]() { for (auto & l : large) { sum += l; } });
+                ThreadPool::instance()->enqueue(std::move(job)).wait();
+                TEST_CHECK_EQUAL(32.0, sum);
+
+                std::function<void ()> function = [&sum]() { sum = 0.0; };
+                ThreadPool::instance()->enqueue(function).wait();
+                TEST_CHECK_EQUAL(0.0, sum);
+            }
+
+            // Threads outside of the pool do not execute jobs while waiting
+            {
+                std::vector<unsigned> on_worker(100, 0u);
+                std::vector<Ticket> tickets;
+
+                TEST_CHECK(! ThreadPool::is_worker_thread());
+
+                for (unsigned i = 0 ; i < on_worker.size() ; ++i)
+                {
+                    tickets.push_back(ThreadPool::instance()->enqueue([&on_worker, i]() { on_worker[i] = ThreadPool::is_worker_thread(); }));
+                }
+
+                for (auto & t : tickets)
+                {
+                    t.wait();
+                }
+
+                for (unsigned i = 0 ; i < on_worker.size() ; ++i)
+                {
+                    TEST_CHECK(on_worker[i]);
+                }
+            }
+
+            // More jobs than fit into the shared queue
+            {
+                std::atomic<unsigned> counter(0);
+                std::vector<Ticket> tickets;
+
+                for (unsigned i = 0 ; i < 10000 ; ++i)
+                {
+                    tickets.push_back(ThreadPool::instance()->enqueue([&counter]() { counter += 1; }));
+                }
+
+                for (auto & t : tickets)
+                {
+                    t.wait();
+                }
+
+                TEST_CHECK_EQUAL(10000u, counter.load());
+                TEST_CHECK_EQUAL(0u, ThreadPool::instance()->statistics().queued_jobs);
+            }
+        }
+} thread_pool_test;
@@ -22,29 +22,192 @@
 #include <eos/utils/lock.hh>
 #include <eos/utils/mutex.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/ticket.hh>
 
-#include <list>
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <new>
+#include <vector>
 
 namespace eos
 {
-    template <> struct Implementation<Ticket>
+    namespace ticket
     {
-        Mutex mutex;
+        /*!
+         * Allocator that recycles the memory of released tickets on a per-thread basis,
+         * so that issuing a ticket does not require a heap allocation in the steady state.
+         */
+        template <typename T_>
+        struct RecyclingAllocator
+        {
+            using value_type = T_;
+
+            static constexpr unsigned max_cached_blocks = 1024;
+
+            struct Block
+            {
+                Block * next;
+            };
+
+            enum State { uninitialised = 0, alive, released };
+
+            // Per-thread cache of released blocks. Trivially destructible, so that
+            // it remains accessible during the destruction of other thread-local objects.
+            struct Cache
+            {
+                Block * head;
+                unsigned size;
+                State state;
+            };
+
+            static thread_local Cache cache;
+
+            // Releases all cached blocks upon thread exit.
+            struct Guard
+            {
+                ~Guard()
+                {
+                    while (cache.head)
+                    {
+                        Block * b = cache.head;
+                        cache.head = b->next;
+                        ::operator delete(b);
+                    }
+
+                    cache.size = 0;
+                    cache.state = released;
+                }
+            };
 
-        ConditionVariable completion;
+            static void initialise()
+            {
+                static thread_local Guard guard;
+                (void) guard;
+
+                cache.state = alive;
+            }
 
-        bool completed;
+            RecyclingAllocator() = default;
+
+            template <typename U_> RecyclingAllocator(const RecyclingAllocator<U_> &)
+            {
+            }
+
+            T_ * allocate(std::size_t n)
+            {
+                static_assert(sizeof(T_) >= sizeof(Block), "Block size too small");
+
+                if ((1 == n) && cache.head)
+                {
+                    Block * b = cache.head;
+                    cache.head = b->next;
+                    --cache.size;
+
+                    return reinterpret_cast<T_ *>(b);
+                }
+
+                return static_cast<T_ *>(::operator new(n * sizeof(T_)));
+            }
+
+            void deallocate(T_ * p, std::size_t n)
+            {
+                if (uninitialised == cache.state)
+                    initialise();
+
+                if ((1 == n) && (alive == cache.state) && (cache.size < max_cached_blocks))
+                {
+                    Block * b = reinterpret_cast<Block *>(p);
+                    b->next = cache.head;
+                    cache.head = b;
+                    ++cache.size;
+
+                    return;
+                }
+
+                ::operator delete(p);
+            }
+
+            template <typename U_> bool operator== (const RecyclingAllocator<U_> &) const { return true; }
+
+            template <typename U_> bool operator!= (const RecyclingAllocator<U_> &) const { return false; }
+        };
+
+        template <typename T_>
+        thread_local typename RecyclingAllocator<T_>::Cache RecyclingAllocator<T_>::cache = { nullptr, 0, RecyclingAllocator<T_>::uninitialised };
+
+        /// Threads that block on a ticket wait on one of a fixed set of condition variables, chosen by the ticket's address.
+        struct WaitStripe
+        {
+            Mutex mutex;
+
+            ConditionVariable completion;
+        };
+
+        static WaitStripe & stripe(const void * ticket)
+        {
+            static WaitStripe stripes[64];
+
+            return stripes[(reinterpret_cast<std::uintptr_t>(ticket) >> 6) % 64];
+        }
+    }
+
+    template <> struct Implementation<Ticket>
+    {
+        std::atomic<bool> completed;
+
+        std::atomic<unsigned> waiters;
 
         Implementation() :
-            completed(false)
+            completed(false),
+            waiters(0)
+        {
+        }
+
+        void mark()
         {
+            completed.store(true);
+
+            if (waiters.load() > 0)
+            {
+                ticket::WaitStripe & s = ticket::stripe(this);
+                Lock l(s.mutex);
+                s.completion.broadcast();
+            }
+        }
+
+        void wait()
+        {
+            // Workers help executing pending jobs, which might include the one they are waiting for.
+            // Other threads might hold locks that the jobs require, and therefore only block.
+            while (ThreadPool::is_worker_thread() && ! completed.load())
+            {
+                if (! ThreadPool::instance()->run_pending_job())
+                    break;
+            }
+
+            if (completed.load())
+                return;
+
+            ticket::WaitStripe & s = ticket::stripe(this);
+            waiters += 1;
+
+            {
+                Lock l(s.mutex);
+
+                while (! completed.load())
+                {
+                    s.completion.wait(s.mutex);
+                }
+            }
+
+            waiters -= 1;
         }
     };
 
     Ticket::Ticket() :
-        PrivateImplementationPattern<Ticket>(new Implementation<Ticket>)
+        PrivateImplementationPattern<Ticket>(std::allocate_shared<Implementation<Ticket>>(ticket::RecyclingAllocator<Implementation<Ticket>>()))
     {
     }
 
@@ -55,26 +218,24 @@ namespace eos
     void
     Ticket::mark()
     {
-        Lock l(_imp->mutex);
+        _imp->mark();
+    }
 
-        _imp->completed = true;
-        _imp->completion.signal();
+    bool
+    Ticket::completed() const
+    {
+        return _imp->completed.load();
     }
 
     void
     Ticket::wait() const
     {
-        Lock l(_imp->mutex);
-
-        while (! _imp->completed)
-        {
-            _imp->completion.wait(_imp->mutex);
-        }
+        _imp->wait();
     }
 
     template <> struct Implementation<TicketList>
     {
-        std::list<std::shared_ptr<Implementation<Ticket> > > tickets;
+        std::vector<std::shared_ptr<Implementation<Ticket> > > tickets;
     };
 
     TicketList::TicketList() :
@@ -95,21 +256,11 @@ namespace eos
     void
     TicketList::wait() const
     {
-        while (! _imp->tickets.empty())
+        for (auto & t : _imp->tickets)
         {
-            std::shared_ptr<Implementation<Ticket> > ticket(_imp->tickets.front());
-
-            {
-                Lock l(ticket->mutex);
-
-                while (! ticket->completed)
-                {
-                    ticket->completion.wait(ticket->mutex);
-                }
-            }
-
-            _imp->tickets.pop_front();
+            t->wait();
         }
+
+        _imp->tickets.clear();
     }
 }
-
@@ -56,7 +56,16 @@ namespace eos
             /// Mark ticket as completed.
             void mark();
 
-            /// Wait for ticket completion.
+            /// Return whether the ticket has been marked as completed.
+            bool completed() const;
+
+            /**
+             * Wait for ticket completion.
+             *
+             * If called from one of the ThreadPool's worker threads, pending jobs of the
+             * pool are executed on the calling thread while waiting. The caller must therefore
+             * not hold any lock that these jobs might acquire. Any other thread merely blocks.
+             */
             void wait() const;
     };
 
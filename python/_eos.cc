@@ -38,6 +38,10 @@
 #include <boost/python.hpp>
 #include <boost/python/raw_function.hpp>
 
+#include <iterator>
+#include <string>
+#include <vector>
+
 using namespace boost::python;
 using namespace eos;
 
@@ -112,6 +116,94 @@ namespace impl
         }
     };
 
+    // copy a Python sequence or buffer (e.g. a NumPy array) into a std::vector
+    template <typename T_>
+    std::vector<T_>
+    to_vector(object sequence, const char * format)
+    {
+        std::vector<T_> result;
+
+        // fast path: contiguous buffers of the right type, e.g. numpy.float64 arrays
+        if (PyObject_CheckBuffer(sequence.ptr()))
+        {
+            Py_buffer view;
+            if (0 == PyObject_GetBuffer(sequence.ptr(), &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+            {
+                if ((1 == view.ndim) && (sizeof(T_) == view.itemsize) && (std::string(format) == view.format))
+                {
+                    const T_ * data = static_cast<const T_ *>(view.buf);
+                    result.assign(data, data + view.shape[0]);
+                    PyBuffer_Release(&view);
+
+                    return result;
+                }
+                PyBuffer_Release(&view);
+            }
+            PyErr_Clear();
+        }
+
+        // slow path: any iterable sequence
+        const auto size = len(sequence);
+        result.reserve(size);
+        for (decltype(len(sequence)) i = 0 ; i < size ; ++i)
+        {
+            result.push_back(extract<T_>(sequence[i]));
+        }
+
+        return result;
+    }
+
+    // batch setter for class Parameters
+    void
+    Parameters_set_many(Parameters & parameters, object ids, object values)
+    {
+        parameters.set_many(to_vector<unsigned>(ids, "I"), to_vector<double>(values, "d"));
+    }
+
+    // batch evaluation for class LogPosterior, with C-contiguous float64 buffers (e.g. NumPy arrays) for input and output
+    void
+    LogPosterior_evaluate_batch(const LogPosterior & log_posterior, object points, object out)
+    {
+        Py_buffer points_view, out_view;
+
+        if (0 != PyObject_GetBuffer(points.ptr(), &points_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+            throw_error_already_set();
+
+        if (0 != PyObject_GetBuffer(out.ptr(), &out_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | PyBUF_WRITABLE))
+        {
+            PyBuffer_Release(&points_view);
+            throw_error_already_set();
+        }
+
+        const std::size_t dim = std::distance(log_posterior.begin(), log_posterior.end());
+        const std::size_t n = out_view.len / sizeof(double);
+        const bool valid = (std::string("d") == points_view.format) && (std::string("d") == out_view.format)
+            && (std::size_t(points_view.len) == n * dim * sizeof(double));
+
+        if (valid)
+        {
+            try
+            {
+                log_posterior.evaluate_batch(static_cast<const double *>(points_view.buf), n, static_cast<double *>(out_view.buf));
+            }
+            catch (...)
+            {
+                PyBuffer_Release(&points_view);
+                PyBuffer_Release(&out_view);
+                throw;
+            }
+        }
+
+        PyBuffer_Release(&points_view);
+        PyBuffer_Release(&out_view);
+
+        if (! valid)
+        {
+            PyErr_SetString(PyExc_ValueError, "evaluate_batch requires float64 buffers of shape (n, d) for points and (n,) for out");
+            throw_error_already_set();
+        }
+    }
+
     const char *
     version(void)
     {
@@ -213,6 +305,14 @@ BOOST_PYTHON_MODULE(_eos)
         .def("declare", &Parameters::declare, return_value_policy<return_by_value>())
         .def("sections", range(&Parameters::begin_sections, &Parameters::end_sections))
         .def("set", &Parameters::set)
+        .def("set_many", &impl::Parameters_set_many, R"(
+            Set the numeric values of several parameters at once, advancing the generation of the parameters only once.
+
+            :param ids: The ids of the parameters that shall be changed.
+            :type ids: iterable of int, e.g. numpy.ndarray with dtype numpy.uintc
+            :param values: The new numeric values, in the same order as the ids.
+            :type values: iterable of float, e.g. numpy.ndarray with dtype numpy.float64
+        )")
         .def("override_from_file", &Parameters::override_from_file)
         ;
 
@@ -228,6 +328,7 @@ BOOST_PYTHON_MODULE(_eos)
         .def("set_max", &Parameter::set_max)
         .def("set_min", &Parameter::set_min)
         .def("evaluate", &Parameter::evaluate)
+        .def("id", &Parameter::id)
         ;
 
     // ParameterUser
@@ -435,6 +536,14 @@ BOOST_PYTHON_MODULE(_eos)
         .def("add", &LogPosterior::add)
         .def("log_likelihood", &LogPosterior::log_likelihood)
         .def("evaluate", &LogPosterior::evaluate)
+        .def("evaluate_batch", &impl::LogPosterior_evaluate_batch, R"(
+            Evaluates the log(posterior) for a batch of parameter points in parallel.
+
+            :param points: The parameter points, with one row per point and the elements of each row in the same order as the priors.
+            :type points: numpy.ndarray of shape (n, d) and dtype numpy.float64, C-contiguous
+            :param out: The array receiving the log(posterior) values.
+            :type out: numpy.ndarray of shape (n,) and dtype numpy.float64, C-contiguous
+        )", args("points", "out"))
         ;
 
     // test_statistics::ChiSquare
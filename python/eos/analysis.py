@@ -118,6 +118,9 @@ class Analysis:
             p.set_max(maxv)
             self.varied_parameters.append(p)
 
+        # ids of the varied parameters, for batch updates of the parameter point
+        self._varied_parameter_ids = np.array([p.id() for p in self.varied_parameters], dtype=np.uintc)
+
         # create the likelihood
         for constraint_name in likelihood:
             constraint = eos.Constraint.make(constraint_name, self.global_options)
@@ -197,8 +200,7 @@ class Analysis:
         :param args: Dummy parameter (ignored)
         :type args: optional
         """
-        for p, v in zip(self.varied_parameters, x):
-            p.set(v)
+        self.parameters.set_many(self._varied_parameter_ids, np.asarray(x, dtype=np.float64))
 
         try:
             return(self.log_posterior.evaluate())
@@ -209,6 +211,23 @@ class Analysis:
             return(-np.inf)
 
 
+    def log_pdf_batch(self, x, *args):
+        """
+        Evaluates the log(posterior) for many parameter points at once, in parallel.
+
+        :param x: Parameter points, one per row, with the elements in the same order as in eos.Analysis.varied_parameters.
+        :type x: numpy.ndarray of shape (n, d)
+        :param args: Dummy parameter (ignored)
+        :type args: optional
+        :return: numpy.ndarray of shape (n,) with the values of log(posterior)
+        """
+        x = np.ascontiguousarray(x, dtype=np.float64).reshape(-1, len(self.varied_parameters))
+        result = np.empty(len(x), dtype=np.float64)
+        self.log_posterior.evaluate_batch(x, result)
+
+        return(result)
+
+
     def negative_log_pdf(self, x, *args):
         """
         Adapter for use with external optimization software (e.g. scipy.optimize.minimize) to aid when optimizing the log(posterior).
@@ -218,8 +237,7 @@ class Analysis:
         :param args: Dummy parameter (ignored)
         :type args: optional
         """
-        for p, v in zip(self.varied_parameters, x):
-            p.set(v)
+        self.parameters.set_many(self._varied_parameter_ids, np.asarray(x, dtype=np.float64))
 
         try:
             return(-self.log_posterior.evaluate())
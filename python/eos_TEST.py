@@ -92,6 +92,17 @@ class PythonTests:
         except:
             raise TestFailedError('cannot lookup existing Parameter \'mass::e\'')
 
+        try:
+            import numpy as np
+            m_c, m_e = par['mass::c'], par['mass::e']
+            par.set_many(np.array([m_c.id(), m_e.id()], dtype=np.uintc), np.array([1.5, 0.001]))
+            par.set_many([m_c.id()], [1.25])
+        except:
+            raise TestFailedError('cannot set many Parameters at once')
+
+        if not (m_c.evaluate() == 1.25 and m_e.evaluate() == 0.001):
+            raise TestFailedError('setting many Parameters at once yields wrong values')
+
     def check_006_Observable(self):
         """Check if an instance of Observable can be created."""
         from eos import Observable, Parameters, Kinematics, Options, QualifiedName
@@ -162,6 +173,40 @@ class PythonTests:
         except:
             raise TestFailedError('cannot determine running b quark mass')
 
+    def check_009_LogPosterior_evaluate_batch(self):
+        """Check if the log(posterior) can be evaluated for a batch of parameter points."""
+        import numpy as np
+        from eos import Constraint, LogLikelihood, LogPosterior, LogPrior, Options, ParameterRange, Parameters
+
+        p = Parameters.Defaults()
+        llh = LogLikelihood(p)
+        lp = LogPosterior(llh)
+        try:
+            llh.add(Constraint.make('B->D::f_++f_0@HPQCD2015A', Options()))
+            lp.add(LogPrior.Gauss(p, 'B->D::alpha^f+_0@BSZ2015', ParameterRange(0.0, 1.0), 0.6, 0.7, 0.8), False)
+            lp.add(LogPrior.Flat(p, 'B->D::alpha^f+_1@BSZ2015', ParameterRange(-5.0, +5.0)), False)
+        except:
+            raise TestFailedError('cannot create LogPosterior')
+
+        points = np.array([[0.65, -1.0], [0.7, 0.0], [0.75, 1.0]])
+        out = np.zeros(3)
+        try:
+            lp.evaluate_batch(points, out)
+        except:
+            raise TestFailedError('cannot evaluate LogPosterior for a batch of points')
+
+        for point, value in zip(points, out):
+            p['B->D::alpha^f+_0@BSZ2015'].set(point[0])
+            p['B->D::alpha^f+_1@BSZ2015'].set(point[1])
+            if not abs(value - lp.evaluate()) <= 1e-10 * abs(value):
+                raise TestFailedError('batch evaluation yields {} instead of {}'.format(value, lp.evaluate()))
+
+        try:
+            lp.evaluate_batch(points, np.zeros(2))
+            raise TestFailedError('batch evaluation accepts mismatching buffers')
+        except ValueError:
+            pass
+
 # Run all test cases.
 tests = PythonTests()
 for (name, testcase) in inspect.getmembers(tests, predicate=inspect.ismethod):
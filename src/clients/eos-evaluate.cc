@@ -21,6 +21,7 @@
 #include <eos/utils/cartesian-product.hh>
 #include <eos/utils/destringify.hh>
 #include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/integration-statistics.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/power_of.hh>
 
@@ -78,11 +79,14 @@ class CommandLine :
 
         int precision;
 
+        bool profile;
+
         CommandLine() :
             parameters(Parameters::Defaults()),
             budgets{std::make_tuple(std::string("delta"), std::vector<Parameter>())},
             use_budget(false),
-            precision(-1)
+            precision(-1),
+            profile(false)
         {
         }
 
@@ -96,6 +100,14 @@ class CommandLine :
             {
                 std::string argument(*a);
 
+                if ("--profile" == argument)
+                {
+                    profile = true;
+                    IntegrationStatistics::enable();
+
+                    continue;
+                }
+
                 if ("--precision" == argument)
                 {
                 	precision = destringify<unsigned>(*(++a));
@@ -333,12 +345,16 @@ main(int argc, char * argv[])
         {
             evaluate_with_sum_of_squares(*i);
         }
+
+        if (CommandLine::instance()->profile)
+            IntegrationStatistics::instance()->dump(std::cerr);
     }
     catch(DoUsage & e)
     {
         std::cout << e.what() << std::endl;
         std::cout << "Usage: eos-evaluate" << std::endl;
         std::cout << "  [--precision PRECISION]" << std::endl;
+        std::cout << "  [--profile]" << std::endl;
         std::cout << "  [--vary PARAMETER]*" << std::endl;
         std::cout << "  [{--budget BUDGET[--parameter PARAMETER]*}*|{--parameter PARAMETER}*]" << std::endl;
         std::cout << "  [[--kinematics NAME VALUE|--range NAME MIN MAX POINTS]* --observable OBSERVABLE]*" << std::endl;